@@ -12,6 +12,7 @@
 */
 #include "LinkedList.h"
 #include<cstdlib>		// abs
+#include<utility>		// move
 class BigInt
 {
 private:
@@ -25,28 +26,32 @@ public:
 	// to a new BigInt
 	BigInt(unsigned long long num);
 	// Copy Constructor
-	BigInt(BigInt &num);
+	BigInt(const BigInt &num);
+	// Move Constructor, takes num's digits
+	BigInt(BigInt &&num) noexcept;
 	// Copy assign
-	BigInt &operator=(BigInt & rhs);
+	BigInt &operator=(const BigInt & rhs);
+	// Move assign, takes rhs's digits
+	BigInt &operator=(BigInt && rhs) noexcept;
 	// User defined assign
 	// Copies num into thisBigInt
 	BigInt &operator=(unsigned long long rhs);
 	// Adds two BigInts, returns a newBigInt
-	BigInt &operator+(BigInt &rhs);
+	BigInt operator+(const BigInt &rhs) const;
 	// Assigns the sum of thisBigInt and
 	// rhs to thisBigInt
-	BigInt &operator+=(BigInt &rhs);
+	BigInt &operator+=(const BigInt &rhs);
 	// Multiplies two BigInts, returns a
 	// newBigInt
-	BigInt &operator*(BigInt &rhs);
+	BigInt operator*(const BigInt &rhs) const;
 	// Assigns the product of thisBigInt and
 	// rhs to thisBigInt
-	BigInt &operator*=(BigInt &rhs);
+	BigInt &operator*=(const BigInt &rhs);
 	// Returns the 9s compliment of thisBigInt
-	BigInt &operator-(BigInt &rhs);
+	BigInt operator-(const BigInt &rhs) const;
 	// Assigns the difference of thisBigInt and
 	// rhs to thisBigInt
-	BigInt &operator-=(BigInt &rhs);
+	BigInt &operator-=(const BigInt &rhs);
 	// Adds one to thisBigInt
 	BigInt &operator++();
 	// Subtracts one from thisBigInt
@@ -54,9 +59,9 @@ public:
 	// -1 for lhs < rhs,
 	// 0 for lhs == rhs,
 	// 1 for lhs > rhs
-	int compare(BigInt &lhs, BigInt &rhs);
+	int compare(const BigInt &lhs, const BigInt &rhs) const;
 	// returns thisBigInt's itemCount
-	int getSize();
+	int getSize() const;
 	// Prints a BigInt in readable direction
 	// instead of reverse
 	friend std::ostream &operator<<(std::ostream& os, const BigInt& num);
@@ -75,12 +80,13 @@ BigInt::BigInt(unsigned long long num)
 	else
 		number.push(0);
 }
-// Uses the LinkedList.h operator= function
-// Reverse the number for ease of BigInt.h
-// function usage
-BigInt::BigInt(BigInt &num)
+// Uses the LinkedList.h copy constructor
+BigInt::BigInt(const BigInt &num) : number(num.number)
+{
+}
+// Uses the LinkedList.h move constructor, O(1)
+BigInt::BigInt(BigInt &&num) noexcept : number(std::move(num.number))
 {
-	number = num.number;
 }
 // Destroy thisBigInt and push each digit of num
 // into thisBigInt (reverse order)
@@ -99,22 +105,28 @@ BigInt &BigInt::operator=(unsigned long long rhs)
 	return *this;
 }
 // Uses the LinkedList.h operator= function
-// Reverse the number for ease of BigInt.h
-// function usage
-BigInt &BigInt::operator=(BigInt & rhs)
+BigInt &BigInt::operator=(const BigInt & rhs)
+{
+	if (this != &rhs)
+		number = rhs.number;
+	return *this;
+}
+// Uses the LinkedList.h move assignment, O(1)
+BigInt &BigInt::operator=(BigInt && rhs) noexcept
 {
-	number = rhs.number;
+	number = std::move(rhs.number);
 	return *this;
 }
 // num is already in reverse, so print it in reverse
 // will make it readable
+// Digits go back to back into os through one buffer
 std::ostream & operator<<(std::ostream & os, const BigInt & rhs)
 {
-	rhs.number.printList(-1);
+	rhs.number.printList(os, LinkedList<unsigned long long>::Reverse, "");
 	return os;
 }
 // returns thisBigInt's itemCount
-int BigInt::getSize()
+int BigInt::getSize() const
 {
 	return number.getLength();
 }
@@ -122,56 +134,55 @@ int BigInt::getSize()
 // traverse both numbers
 // push the sum of the digits of lhs and rhs and carry
 // to newNumber
-BigInt &BigInt::operator+(BigInt &rhs)
+// newNumber is returned by value, which moves its digits
+BigInt BigInt::operator+(const BigInt &rhs) const
 {
-	BigInt *sum = new BigInt();
-	sum->number.pop();
-	Node<unsigned long long> *ls = number.traverse(true);
-	Node<unsigned long long> *rs = rhs.number.traverse(true);
+	BigInt sum;
+	sum.number.pop();
+	LinkedList<unsigned long long>::const_iterator ls = number.cbegin(), rs = rhs.number.cbegin();
+	LinkedList<unsigned long long>::const_iterator lend = number.cend(), rend = rhs.number.cend();
 	int left, right, total, digit, carry = 0;
-	while (ls || rs || carry)
+	while (ls != lend || rs != rend || carry)
 	{
-		if (ls == nullptr)
+		if (ls == lend)
 			left = 0;
 		else
-			left = ls->getItem();
-		if (rs == nullptr)
+			left = *ls++;
+		if (rs == rend)
 			right = 0;
 		else
-			right = rs->getItem();
+			right = *rs++;
 		total = left + right + carry;
 		digit = total % 10;
 		carry = total / 10;
-		sum->number.push(digit);
-		if (ls != nullptr) ls = ls->getNext();
-		if (rs != nullptr) rs = rs->getNext();
+		sum.number.push(digit);
 	}
-	sum->normalize();
-	return *sum;
+	sum.normalize();
+	return sum;
 }
 // Create newNumber and empty it
 // traverse both numbers
 // push the difference of the digits of lhs
 // and rhs and add the carry to newNumber
-BigInt &BigInt::operator-(BigInt &rhs)
+BigInt BigInt::operator-(const BigInt &rhs) const
 {
-	BigInt *diff = new BigInt();
+	BigInt diff;
 	int cmp = compare(*this, rhs);
-	if (cmp == 0 || cmp == -1) return *diff;
-	diff->number.pop();
-	Node<unsigned long long> *ls = number.traverse(true);
-	Node<unsigned long long> *rs = rhs.number.traverse(true);
+	if (cmp == 0 || cmp == -1) return diff;
+	diff.number.pop();
+	LinkedList<unsigned long long>::const_iterator ls = number.cbegin(), rs = rhs.number.cbegin();
+	LinkedList<unsigned long long>::const_iterator lend = number.cend(), rend = rhs.number.cend();
 	int left, right, sum, carry = 0;
-	while (ls || rs || carry)
+	while (ls != lend || rs != rend || carry)
 	{
-		if (ls == nullptr)
+		if (ls == lend)
 			left = 0;
 		else
-			left = ls->getItem();
-		if (rs == nullptr)
+			left = *ls++;
+		if (rs == rend)
 			right = 0;
 		else
-			right = rs->getItem();
+			right = *rs++;
 		sum = left - right + carry;
 		carry = 0;
 		if (sum < 0)
@@ -179,12 +190,10 @@ BigInt &BigInt::operator-(BigInt &rhs)
 			sum += 10;
 			carry = -1;
 		}
-		diff->number.push(sum % 10);
-		if (ls != nullptr) ls = ls->getNext();
-		if (rs != nullptr) rs = rs->getNext();
+		diff.number.push(sum % 10);
 	}
-	diff->normalize();
-	return *diff;
+	diff.normalize();
+	return diff;
 }
 // Performs multiplication using this method:
 /*
@@ -199,57 +208,51 @@ BigInt &BigInt::operator-(BigInt &rhs)
 *    product[b_i + p] += carry
 * end for
 */
+// Each row of product starts one digit further in, so a row iterator
+// walks product alongside a instead of looking up product[a_i + b_i - 1]
 // Then it reverses the number and removes any excess
 // zeros that were added during allocation portion
 // finally reversing it for further use and returning
 // newNumber
-BigInt &BigInt::operator*(BigInt &rhs)
+BigInt BigInt::operator*(const BigInt &rhs) const
 {
-	BigInt *product = new BigInt();
-	product->number.resize(this->number.getLength() + rhs.number.getLength(), 0);
-	Node<unsigned long long> *productPtr = product->number.traverse(true), *a_i, *b_i;
+	BigInt product;
+	product.number.resize(this->number.getLength() + rhs.number.getLength(), 0);
+	LinkedList<unsigned long long>::iterator row = product.number.begin(), productPtr;
+	LinkedList<unsigned long long>::const_iterator a_i, b_i;
 	unsigned long long carry;
-	int i, j;
-	for (i = 1, b_i = rhs.number.traverse(true);
-		b_i != nullptr;
-		++i, b_i = rhs.number.traverse(false))
+	for (b_i = rhs.number.cbegin(); b_i != rhs.number.cend(); ++b_i, ++row)
 	{
 		carry = 0;
-		for (j = 1, a_i = number.traverse(true);
-			a_i != nullptr;
-			++j, a_i = number.traverse(false))
+		for (a_i = number.cbegin(), productPtr = row; a_i != number.cend(); ++a_i, ++productPtr)
 		{
-			productPtr = product->number.getNodeAt(i + j - 1);
-			productPtr->setItem(productPtr->getItem() + \
-				carry + a_i->getItem() * b_i->getItem());
-			carry = productPtr->getItem() / 10;
-			productPtr->setItem(productPtr->getItem() % 10);
-			productPtr = productPtr->getNext();
+			*productPtr += carry + *a_i * *b_i;
+			carry = *productPtr / 10;
+			*productPtr %= 10;
 		}
-		productPtr = product->number.getNodeAt(i + number.getLength());
-		productPtr->setItem(productPtr->getItem() + carry);
+		*productPtr += carry;
 	}
-	product->number.reverse();
-	product->normalize();
-	return *product;
+	product.number.reverse();
+	product.normalize();
+	return product;
 }
 // Adds two BigInts and assigns it to
 // thisBigInt
-BigInt & BigInt::operator+=(BigInt & rhs)
+BigInt & BigInt::operator+=(const BigInt & rhs)
 {
 	*this = *this + rhs;
 	return *this;
 }
 // Assigns the product of thisBigInt and rhs
 // to thisBigInt
-BigInt & BigInt::operator*=(BigInt & rhs)
+BigInt & BigInt::operator*=(const BigInt & rhs)
 {
 	*this = *this * rhs;
 	return *this;
 }
 // Assigns the difference of thisBigInt
 // and rhs to thisBigInt
-BigInt &BigInt::operator-=(BigInt & rhs)
+BigInt &BigInt::operator-=(const BigInt & rhs)
 {
 	*this = *this - rhs;
 	return *this;
@@ -270,40 +273,29 @@ BigInt &BigInt::operator--()
 }
 // Compares size for greater or less
 // if size is equal compare digits
-// Since the numbers are held in reverse,
-// reverse so comparisons can be performed
-// at the front
-int BigInt::compare(BigInt &lhs, BigInt &rhs)
+// Since the numbers are held in reverse, the last
+// digit that differs is the most significant one
+int BigInt::compare(const BigInt &lhs, const BigInt &rhs) const
 {
-	if (number.getLength() < rhs.number.getLength())
+	if (lhs.number.getLength() < rhs.number.getLength())
 		return -1;
-	if (number.getLength() > rhs.number.getLength())
+	if (lhs.number.getLength() > rhs.number.getLength())
 		return 1;
-	number.reverse();
-	rhs.number.reverse();
-	Node<unsigned long long> *i = number.traverse(true);
-	Node<unsigned long long> *j = rhs.number.traverse(true);
+	LinkedList<unsigned long long>::const_iterator i = lhs.number.cbegin();
+	LinkedList<unsigned long long>::const_iterator j = rhs.number.cbegin();
 	int cmp = 0;
-	while (i && cmp == 0)
+	for (; i != lhs.number.cend(); ++i, ++j)
 	{
-		cmp = ((i->getItem() > j->getItem()) ? (1) : \
-			(((i->getItem() < j->getItem())) ? (-1) : (0)));
-		i = i->getNext();
-		j = j->getNext();
+		if (*i != *j)
+			cmp = ((*i > *j) ? (1) : (-1));
 	}
-	number.reverse();
-	rhs.number.reverse();
 	return cmp;
 }
 BigInt &BigInt::normalize()
 {
-	Node<unsigned long long> *productPtr = number.traverse(true);
 	while (number.getLength() > 1 &&
 		this->number.getEntry(1) == 0)
-	{
 		number.pop();
-		productPtr = number.traverse(true);
-	}
 	number.reverse();
 	return *this;
 }
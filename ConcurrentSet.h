@@ -0,0 +1,247 @@
+/*
+* ConcurrentSet.h
+* Daniel Salazar
+* 10/18/2026
+* A lock-free sorted set (Harris/Michael ordered list) with the
+* insertSorted/isInList/remove surface of a sorted LinkedList
+* Any number of threads may use it at once without a mutex
+* isInList is wait-free: it walks the list once and never retries
+* insertSorted and remove are lock-free: each is a compare and swap
+* on one link, retried only when another thread changed that link
+* remove first marks a Node deleted by setting the low bit of its
+* next, then unlinks it; any thread that walks past a marked Node
+* helps unlink it
+* Unlinked Nodes are retired through EpochReclaim and go back to
+* the Allocator's node pool once no thread can still reach them
+* SetNode<ItemType> is the List Element
+* ConcurrentSet<ItemType, Allocator> is the collection
+*/
+#ifndef CONCURRENTSET_H
+#define CONCURRENTSET_H
+#include "NodeAllocator.h"
+#include "EpochReclaim.h"
+#include <atomic>		// atomic
+#include <cstdint>		// uintptr_t
+#include <new>			// placement new
+#include <utility>		// forward
+// A Node whose next carries a deleted mark in its low bit
+template<class ItemType>
+class SetNode
+{
+private:
+	ItemType item;
+	std::atomic<std::uintptr_t> next;
+public:
+	// Builds item in place from args, unlinked and unmarked
+	template<class... Args>
+	SetNode(Args&&... args);
+	// Get Node's Item
+	const ItemType& getItem() const;
+	// Node's next and deleted mark as one word
+	std::atomic<std::uintptr_t>& getLink();
+	// Splits a link word into its Node and its mark
+	static SetNode<ItemType>* getPtr(std::uintptr_t link);
+	static bool isMarked(std::uintptr_t link);
+	// Builds a link word from a Node and a mark
+	static std::uintptr_t makeLink(SetNode<ItemType>* nodePtr, bool marked);
+};
+template<class ItemType>
+template<class... Args>
+SetNode<ItemType>::SetNode(Args&&... args) : item(std::forward<Args>(args)...), next(0)
+{
+}
+template<class ItemType>
+inline const ItemType& SetNode<ItemType>::getItem() const
+{
+	return item;
+}
+template<class ItemType>
+inline std::atomic<std::uintptr_t>& SetNode<ItemType>::getLink()
+{
+	return next;
+}
+template<class ItemType>
+inline SetNode<ItemType>* SetNode<ItemType>::getPtr(std::uintptr_t link)
+{
+	return reinterpret_cast<SetNode<ItemType>*>(link & ~std::uintptr_t(1));
+}
+template<class ItemType>
+inline bool SetNode<ItemType>::isMarked(std::uintptr_t link)
+{
+	return (link & 1) != 0;
+}
+template<class ItemType>
+inline std::uintptr_t SetNode<ItemType>::makeLink(SetNode<ItemType>* nodePtr, bool marked)
+{
+	return reinterpret_cast<std::uintptr_t>(nodePtr) | (marked ? 1 : 0);
+}
+// Sorted set of SetNodes, ascending by operator<
+// Items only need operator<, two items are equal if neither is less
+template<class ItemType, class Allocator = SlabAllocator<SetNode<ItemType> > >
+class ConcurrentSet
+{
+private:
+	// Reclaims unlinked Nodes into Allocator once no thread can reach them
+	typedef EpochReclaim<SetNode<ItemType>, Allocator> Epochs;
+	// Link to nullptr/First Node, never marked
+	std::atomic<std::uintptr_t> head;
+	// Finds the first Node not less than anEntry, unlinking marked
+	// Nodes on the way; prevLink is the link that points at it
+	SetNode<ItemType>* find(const ItemType& anEntry, std::atomic<std::uintptr_t>*& prevLink);
+	// Not copyable, a copy couldn't be taken atomically
+	ConcurrentSet(const ConcurrentSet<ItemType, Allocator>& aSet);
+	ConcurrentSet<ItemType, Allocator>& operator=(const ConcurrentSet<ItemType, Allocator>& aSet);
+public:
+	// Default constructor
+	ConcurrentSet();
+	// Destructor, no other thread may be using thisSet
+	~ConcurrentSet();
+	// Wait-free search for anEntry
+	bool isInList(const ItemType& anEntry) const;
+	// Inserts a Node in ascending order, false if anEntry is already in
+	bool insertSorted(const ItemType& newEntry);
+	// Removes the Node equal to anEntry, false if there is none
+	bool remove(const ItemType& anEntry);
+	// Checks if thisSet has no unmarked Nodes at the moment
+	bool isEmpty() const;
+};
+// Start out empty
+template<class ItemType, class Allocator>
+ConcurrentSet<ItemType, Allocator>::ConcurrentSet() : head(0)
+{
+}
+// Nothing else runs, so free every Node straight back to Allocator
+template<class ItemType, class Allocator>
+ConcurrentSet<ItemType, Allocator>::~ConcurrentSet()
+{
+	SetNode<ItemType>* curPtr = SetNode<ItemType>::getPtr(head.load(std::memory_order_acquire)), *prevPtr;
+	while (curPtr != nullptr)
+	{
+		prevPtr = curPtr;
+		curPtr = SetNode<ItemType>::getPtr(curPtr->getLink().load(std::memory_order_relaxed));
+		prevPtr->~SetNode<ItemType>();
+		Allocator::deallocate(prevPtr);
+	}
+}
+// Caller is inside an epoch
+// Inchworm down the List from head
+// If curPtr is marked, swing prevLink past it and retire it,
+//  start over from head if prevLink changed under us
+// Stop at the first unmarked Node not less than anEntry (or nullptr)
+template<class ItemType, class Allocator>
+SetNode<ItemType>* ConcurrentSet<ItemType, Allocator>::find(const ItemType& anEntry, std::atomic<std::uintptr_t>*& prevLink)
+{
+retry:
+	prevLink = &head;
+	SetNode<ItemType>* curPtr = SetNode<ItemType>::getPtr(prevLink->load(std::memory_order_acquire));
+	while (curPtr != nullptr)
+	{
+		std::uintptr_t nextLink = curPtr->getLink().load(std::memory_order_acquire);
+		if (SetNode<ItemType>::isMarked(nextLink))
+		{
+			std::uintptr_t expected = SetNode<ItemType>::makeLink(curPtr, false);
+			SetNode<ItemType>* nextPtr = SetNode<ItemType>::getPtr(nextLink);
+			if (!prevLink->compare_exchange_strong(expected, SetNode<ItemType>::makeLink(nextPtr, false),
+				std::memory_order_acq_rel, std::memory_order_acquire))
+				goto retry;
+			Epochs::retire(curPtr);
+			curPtr = nextPtr;
+		}
+		else
+		{
+			if (!(curPtr->getItem() < anEntry))
+				return curPtr;
+			prevLink = &curPtr->getLink();
+			curPtr = SetNode<ItemType>::getPtr(nextLink);
+		}
+	}
+	return nullptr;
+}
+// Walk past every Node less than anEntry, marked or not
+// anEntry is in if the Node reached is equal and not marked
+template<class ItemType, class Allocator>
+bool ConcurrentSet<ItemType, Allocator>::isInList(const ItemType& anEntry) const
+{
+	EpochGuard<Epochs> guard;
+	SetNode<ItemType>* curPtr = SetNode<ItemType>::getPtr(head.load(std::memory_order_acquire));
+	while (curPtr != nullptr && curPtr->getItem() < anEntry)
+		curPtr = SetNode<ItemType>::getPtr(curPtr->getLink().load(std::memory_order_acquire));
+	return curPtr != nullptr && !(anEntry < curPtr->getItem()) &&
+		!SetNode<ItemType>::isMarked(curPtr->getLink().load(std::memory_order_acquire));
+}
+// Find where newEntry goes, give up if it is already there
+// Point a new Node at the Node found and swing prevLink to it
+// If prevLink changed (a Node went in or was marked), find again
+template<class ItemType, class Allocator>
+bool ConcurrentSet<ItemType, Allocator>::insertSorted(const ItemType& newEntry)
+{
+	EpochGuard<Epochs> guard;
+	SetNode<ItemType>* newNode = nullptr;
+	for (;;)
+	{
+		std::atomic<std::uintptr_t>* prevLink;
+		SetNode<ItemType>* curPtr = find(newEntry, prevLink);
+		if (curPtr != nullptr && !(newEntry < curPtr->getItem()))
+		{
+			if (newNode != nullptr)
+			{
+				newNode->~SetNode<ItemType>();
+				Allocator::deallocate(newNode);
+			}
+			return false;
+		}
+		if (newNode == nullptr)
+			newNode = new (Allocator::allocate()) SetNode<ItemType>(newEntry);
+		newNode->getLink().store(SetNode<ItemType>::makeLink(curPtr, false), std::memory_order_relaxed);
+		std::uintptr_t expected = SetNode<ItemType>::makeLink(curPtr, false);
+		if (prevLink->compare_exchange_strong(expected, SetNode<ItemType>::makeLink(newNode, false),
+			std::memory_order_release, std::memory_order_relaxed))
+			return true;
+	}
+}
+// Find the Node equal to anEntry, give up if there is none
+// Mark it deleted by setting the low bit of its next, if another
+//  thread changed that next first, find again
+// The mark is the moment of removal; then try to unlink it, and
+//  if that fails find will unlink it on the way
+template<class ItemType, class Allocator>
+bool ConcurrentSet<ItemType, Allocator>::remove(const ItemType& anEntry)
+{
+	EpochGuard<Epochs> guard;
+	for (;;)
+	{
+		std::atomic<std::uintptr_t>* prevLink;
+		SetNode<ItemType>* curPtr = find(anEntry, prevLink);
+		if (curPtr == nullptr || anEntry < curPtr->getItem())
+			return false;
+		std::uintptr_t nextLink = curPtr->getLink().load(std::memory_order_acquire);
+		if (SetNode<ItemType>::isMarked(nextLink))
+			continue;
+		SetNode<ItemType>* nextPtr = SetNode<ItemType>::getPtr(nextLink);
+		if (!curPtr->getLink().compare_exchange_strong(nextLink, SetNode<ItemType>::makeLink(nextPtr, true),
+			std::memory_order_acq_rel, std::memory_order_relaxed))
+			continue;
+		std::uintptr_t expected = SetNode<ItemType>::makeLink(curPtr, false);
+		if (prevLink->compare_exchange_strong(expected, SetNode<ItemType>::makeLink(nextPtr, false),
+			std::memory_order_acq_rel, std::memory_order_relaxed))
+			Epochs::retire(curPtr);
+		else
+			find(anEntry, prevLink);
+		return true;
+	}
+}
+// Skip marked Nodes, empty if none is left
+template<class ItemType, class Allocator>
+bool ConcurrentSet<ItemType, Allocator>::isEmpty() const
+{
+	EpochGuard<Epochs> guard;
+	SetNode<ItemType>* curPtr = SetNode<ItemType>::getPtr(head.load(std::memory_order_acquire));
+	while (curPtr != nullptr)
+	{
+		std::uintptr_t nextLink = curPtr->getLink().load(std::memory_order_acquire);
+		if (!SetNode<ItemType>::isMarked(nextLink)) return false;
+		curPtr = SetNode<ItemType>::getPtr(nextLink);
+	}
+	return true;
+}
+#endif
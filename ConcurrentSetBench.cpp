@@ -0,0 +1,137 @@
+/*
+* ConcurrentSetBench.cpp
+* Daniel Salazar
+* 10/18/2026
+* Stress test and throughput benchmark for ConcurrentSet.h
+* Stress: every thread inserts and removes its own keys, interleaved
+* with every other thread's keys in one shared set, and checks the
+* set against its own record of which keys are in
+* Benchmark: threads run a random mix of isInList, insertSorted and
+* remove over a shared key range for a fixed time, for each thread
+* count and read percentage, and report millions of ops per second
+* Usage: ConcurrentSetBench [maxThreads] [keyRange] [milliseconds]
+*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "ConcurrentSet.h"
+// Small per thread generator, so threads don't share rand's state
+struct XorShift
+{
+	unsigned int state;
+	unsigned int next()
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+};
+// Thread t owns the keys k where k % threads == t
+// Every thread needs a key, so there are at most keyRange threads
+// Each op flips or checks one of its keys and compares with inList
+// Returns the number of mismatches
+int stress(int threads, int keyRange, int ops)
+{
+	threads = std::min(threads, keyRange);
+	ConcurrentSet<int> set;
+	std::atomic<int> errors(0);
+	std::vector<std::thread> pool;
+	for (int t = 0; t < threads; ++t)
+		pool.push_back(std::thread([&, t]()
+		{
+			XorShift rng = { 2463534242u + t };
+			int owned = keyRange / threads;
+			std::vector<bool> inList(owned, false);
+			for (int i = 0; i < ops; ++i)
+			{
+				int index = rng.next() % owned;
+				int key = index * threads + t;
+				switch (rng.next() % 3)
+				{
+				case 0:
+					if (set.insertSorted(key) == inList[index]) ++errors;
+					inList[index] = true;
+					break;
+				case 1:
+					if (set.remove(key) != inList[index]) ++errors;
+					inList[index] = false;
+					break;
+				default:
+					if (set.isInList(key) != inList[index]) ++errors;
+				}
+			}
+			for (int index = 0; index < owned; ++index)
+				if (set.isInList(index * threads + t) != inList[index]) ++errors;
+		}));
+	for (std::size_t t = 0; t < pool.size(); ++t)
+		pool[t].join();
+	return errors;
+}
+// Fill half the key range, then let every thread run the mix
+// until time is up, counting its ops
+double bench(int threads, int keyRange, int readPercent, int milliseconds)
+{
+	ConcurrentSet<int> set;
+	XorShift fill = { 88172645u };
+	for (int i = 0; i < keyRange / 2; ++i)
+		set.insertSorted(fill.next() % keyRange);
+	std::atomic<bool> go(false), stop(false);
+	std::atomic<long> total(0);
+	std::vector<std::thread> pool;
+	for (int t = 0; t < threads; ++t)
+		pool.push_back(std::thread([&, t]()
+		{
+			XorShift rng = { 123456789u + 7919u * t };
+			long count = 0;
+			while (!go.load(std::memory_order_acquire));
+			while (!stop.load(std::memory_order_relaxed))
+			{
+				int key = rng.next() % keyRange;
+				int dice = rng.next() % 100;
+				if (dice < readPercent)
+					set.isInList(key);
+				else if ((dice & 1) == 0)
+					set.insertSorted(key);
+				else
+					set.remove(key);
+				++count;
+			}
+			total += count;
+		}));
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	go.store(true, std::memory_order_release);
+	std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+	stop.store(true);
+	for (std::size_t t = 0; t < pool.size(); ++t)
+		pool[t].join();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return total / seconds / 1e6;
+}
+int main(int argc, char* argv[])
+{
+	int maxThreads = (argc > 1) ? std::atoi(argv[1]) : int(std::thread::hardware_concurrency());
+	int keyRange = (argc > 2) ? std::atoi(argv[2]) : 1024;
+	int milliseconds = (argc > 3) ? std::atoi(argv[3]) : 500;
+	if (maxThreads < 1) maxThreads = 1;
+	if (keyRange < 1) keyRange = 1;
+	int errors = stress(maxThreads > 1 ? maxThreads : 2, keyRange, 200000);
+	std::cout << "stress: " << errors << " mismatches" << std::endl;
+	const int readPercents[] = { 100, 90, 50, 0 };
+	std::cout << "threads";
+	for (int r = 0; r < 4; ++r)
+		std::cout << "\t" << readPercents[r] << "% read";
+	std::cout << "\t(Mops/s, " << keyRange << " keys)" << std::endl;
+	for (int threads = 1; threads <= maxThreads; threads *= 2)
+	{
+		std::cout << threads;
+		for (int r = 0; r < 4; ++r)
+			std::cout << "\t" << bench(threads, keyRange, readPercents[r], milliseconds);
+		std::cout << std::endl;
+	}
+	return errors == 0 ? 0 : 1;
+}
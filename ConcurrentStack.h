@@ -0,0 +1,171 @@
+/*
+* ConcurrentStack.h
+* Daniel Salazar
+* 10/18/2026
+* A lock-free stack (Treiber stack) with LinkedList's push/pop surface
+* Any number of threads may push and pop at once without a mutex
+* The top of the stack is one atomic ptr to the same Node<ItemType>
+* LinkedList uses, swung with compare and swap
+* Popped Nodes are retired through HazardPointers, so a Node another
+* thread is still reading is never recycled (no ABA, no use after free)
+* Storage comes from and goes back to the Allocator's node pool
+*/
+#ifndef CONCURRENTSTACK_H
+#define CONCURRENTSTACK_H
+#include "LinkedList.h"
+#include "HazardPointer.h"
+#include <atomic>		// atomic
+#include <thread>		// this_thread::yield
+template<class ItemType, class Allocator = SlabAllocator<Node<ItemType> > >
+class ConcurrentStack
+{
+private:
+	// Reclaims popped Nodes into Allocator once no thread reads them
+	typedef HazardPointers<Node<ItemType>, Allocator> Hazards;
+	// Points to nullptr/Top Node
+	std::atomic<Node<ItemType>*> top;
+	// Links newNode on top, backing off while other threads win
+	void pushNode(Node<ItemType>* newNode);
+	// Unlinks the top Node, nullptr if empty
+	// The caller owns the Node's item and must retire the Node
+	Node<ItemType>* popNode(void);
+	// Gives up the CPU for a while after a lost compare and swap
+	static void backoff(int& spins);
+	// Not copyable, a copy couldn't be taken atomically
+	ConcurrentStack(const ConcurrentStack<ItemType, Allocator>& aStack);
+	ConcurrentStack<ItemType, Allocator>& operator=(const ConcurrentStack<ItemType, Allocator>& aStack);
+public:
+	// Default constructor
+	ConcurrentStack();
+	// Destructor, no other thread may be using thisStack
+	~ConcurrentStack();
+	// Inserts Node at the top of thisStack
+	void push(const ItemType& newEntry);
+	void push(ItemType&& newEntry);
+	// Builds a Node's item in place from args at the top of thisStack
+	template<class... Args>
+	void emplace(Args&&... args);
+	// Removes top Node, false if thisStack was empty
+	bool pop(void);
+	// Removes top Node and moves its item into anEntry
+	bool pop(ItemType& anEntry);
+	// Checks if thisStack has no Nodes at the moment
+	bool isEmpty() const;
+};
+// Start out empty
+template<class ItemType, class Allocator>
+ConcurrentStack<ItemType, Allocator>::ConcurrentStack() : top(nullptr)
+{
+}
+// Nothing else runs, so pop every Node straight back to Allocator
+template<class ItemType, class Allocator>
+ConcurrentStack<ItemType, Allocator>::~ConcurrentStack()
+{
+	Node<ItemType>* curPtr = top.load(std::memory_order_acquire), *prevPtr;
+	while (curPtr != nullptr)
+	{
+		prevPtr = curPtr;
+		curPtr = curPtr->getNext();
+		prevPtr->~Node<ItemType>();
+		Allocator::deallocate(prevPtr);
+	}
+}
+// Spin a little longer after each loss, then start yielding
+template<class ItemType, class Allocator>
+inline void ConcurrentStack<ItemType, Allocator>::backoff(int& spins)
+{
+	if (spins < 64)
+	{
+		for (volatile int i = 0; i < spins; ++i);
+		spins *= 2;
+	}
+	else
+		std::this_thread::yield();
+}
+// Point newNode at the current top and swing top to newNode
+// If another thread moved top first, retry against the new top
+// push never reads a Node, so it needs no hazard slot
+template<class ItemType, class Allocator>
+void ConcurrentStack<ItemType, Allocator>::pushNode(Node<ItemType>* newNode)
+{
+	Node<ItemType>* curTop = top.load(std::memory_order_relaxed);
+	int spins = 1;
+	for (;;)
+	{
+		newNode->setNext(curTop);
+		if (top.compare_exchange_weak(curTop, newNode,
+			std::memory_order_release, std::memory_order_relaxed))
+			return;
+		backoff(spins);
+	}
+}
+// Protect the top Node so it can't be recycled while it is read
+// Swing top to its next, retrying if another thread moved top first
+// Only the winner of the swap touches the Node's item
+template<class ItemType, class Allocator>
+Node<ItemType>* ConcurrentStack<ItemType, Allocator>::popNode(void)
+{
+	int spins = 1;
+	for (;;)
+	{
+		Node<ItemType>* curTop = Hazards::protect(0, top);
+		if (curTop == nullptr)
+		{
+			Hazards::clear(0);
+			return nullptr;
+		}
+		if (top.compare_exchange_weak(curTop, curTop->getNext(),
+			std::memory_order_acquire, std::memory_order_relaxed))
+		{
+			Hazards::clear(0);
+			return curTop;
+		}
+		backoff(spins);
+	}
+}
+// Copies newEntry into a Node from Allocator and pushes it
+template<class ItemType, class Allocator>
+inline void ConcurrentStack<ItemType, Allocator>::push(const ItemType& newEntry)
+{
+	emplace(newEntry);
+}
+// Moves newEntry into a Node from Allocator and pushes it
+template<class ItemType, class Allocator>
+inline void ConcurrentStack<ItemType, Allocator>::push(ItemType&& newEntry)
+{
+	emplace(std::move(newEntry));
+}
+// Builds a Node's item from args in storage from Allocator and pushes it
+template<class ItemType, class Allocator>
+template<class... Args>
+inline void ConcurrentStack<ItemType, Allocator>::emplace(Args&&... args)
+{
+	Node<ItemType>* nextPtr = nullptr;
+	pushNode(new (Allocator::allocate()) Node<ItemType>(nextPtr, std::forward<Args>(args)...));
+}
+// Unlink the top Node and retire it
+template<class ItemType, class Allocator>
+bool ConcurrentStack<ItemType, Allocator>::pop(void)
+{
+	Node<ItemType>* curPtr = popNode();
+	if (curPtr == nullptr) return false;
+	Hazards::retire(curPtr);
+	return true;
+}
+// Unlink the top Node, move its item out and retire it
+template<class ItemType, class Allocator>
+bool ConcurrentStack<ItemType, Allocator>::pop(ItemType& anEntry)
+{
+	Node<ItemType>* curPtr = popNode();
+	if (curPtr == nullptr) return false;
+	anEntry = std::move(curPtr->getItem());
+	Hazards::retire(curPtr);
+	return true;
+}
+// May be stale as soon as it returns if other threads are at work
+template<class ItemType, class Allocator>
+inline bool ConcurrentStack<ItemType, Allocator>::isEmpty() const
+{
+	return top.load(std::memory_order_acquire) == nullptr;
+}
+#endif
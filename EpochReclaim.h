@@ -0,0 +1,254 @@
+/*
+* EpochReclaim.h
+* Daniel Salazar
+* 10/18/2026
+* Epoch based reclamation for lock-free containers built from Nodes
+* A thread marks itself active in the current epoch for as long as it
+* holds ptrs into a container, and readers never need to publish
+* each Node they step on, so traversals stay wait-free
+* An unlinked Node is retired into the bag for the epoch it was
+* retired in, and destroyed once the global epoch is two ahead:
+* by then every thread that could have seen it has left
+* EpochReclaim<NodeType, Allocator> keeps one record and three bags
+* per thread for each NodeType
+*/
+#ifndef EPOCHRECLAIM_H
+#define EPOCHRECLAIM_H
+#include <atomic>		// atomic
+#include <cstddef>		// size_t
+#include <mutex>		// mutex, lock_guard
+#include <utility>		// pair
+#include <vector>		// vector
+// Every member is static, like the allocator policies, so every
+// container of the same NodeType shares one epoch
+template<class NodeType, class Allocator>
+class EpochReclaim
+{
+private:
+	// Epochs step by 2, the low bit of a Record's state means active
+	// One thread's state, never freed, reused once the thread exits
+	struct Record
+	{
+		std::atomic<unsigned int> state;
+		std::atomic<bool> inUse;
+		Record* next;
+	};
+	// Per thread state
+	struct Local
+	{
+		// This thread's Record, nullptr until first use
+		Record* record;
+		// Nesting depth of enter/leave
+		int depth;
+		// Retired Nodes, by epoch / 2 % 3, and the epoch each bag holds
+		std::vector<NodeType*> bag[3];
+		unsigned int bagEpoch[3];
+		// Hands leftovers to the orphan list
+		~Local();
+	};
+	static thread_local Local local;
+	// The global epoch
+	static std::atomic<unsigned int>& getEpoch(void);
+	// Stack of every Record ever made
+	static std::atomic<Record*>& getRecords(void);
+	// Retired Nodes and their epochs left behind by exited threads
+	static std::mutex& getOrphanLock(void);
+	static std::vector<std::pair<unsigned int, NodeType*> >& getOrphans(void);
+	// Claims a free Record or pushes a new one
+	static Record* acquireRecord(void);
+	// Destroys every Node in aBag and returns them to Allocator
+	static void freeBag(std::vector<NodeType*>& aBag);
+	// Steps the epoch if every active thread has seen this one
+	static void tryAdvance(unsigned int epoch);
+	// Frees the bags and orphans at least two epochs old
+	static void collect(Local& aLocal, unsigned int epoch);
+public:
+	// Bag size that triggers an attempt to step the epoch
+	static const int Threshold = 64;
+	// Marks this thread active in the current epoch, may nest
+	static void enter(void);
+	// Marks this thread quiescent once the outermost enter is left
+	static void leave(void);
+	// Takes over an unlinked Node and reclaims it two epochs later
+	static void retire(NodeType* curPtr);
+};
+// Enters on construction and leaves on destruction
+template<class Reclaim>
+class EpochGuard
+{
+public:
+	EpochGuard() { Reclaim::enter(); }
+	~EpochGuard() { Reclaim::leave(); }
+private:
+	EpochGuard(const EpochGuard<Reclaim>&);
+	EpochGuard<Reclaim>& operator=(const EpochGuard<Reclaim>&);
+};
+// Each thread's state starts out empty
+template<class NodeType, class Allocator>
+thread_local typename EpochReclaim<NodeType, Allocator>::Local
+	EpochReclaim<NodeType, Allocator>::local;
+// Retired Nodes go to the orphan list for another thread to free,
+// Allocator's per thread cache may already be gone at this point
+// Free up the Record for the next thread
+template<class NodeType, class Allocator>
+EpochReclaim<NodeType, Allocator>::Local::~Local()
+{
+	if (record == nullptr) return;
+	record->state.store(0, std::memory_order_release);
+	{
+		std::lock_guard<std::mutex> guard(getOrphanLock());
+		std::vector<std::pair<unsigned int, NodeType*> >& orphans = getOrphans();
+		for (int i = 0; i < 3; ++i)
+		{
+			for (std::size_t j = 0; j < bag[i].size(); ++j)
+				orphans.push_back(std::make_pair(bagEpoch[i], bag[i][j]));
+			bag[i].clear();
+		}
+	}
+	record->inUse.store(false, std::memory_order_release);
+	record = nullptr;
+}
+// Function local statics so they exist before any thread uses them
+template<class NodeType, class Allocator>
+std::atomic<unsigned int>& EpochReclaim<NodeType, Allocator>::getEpoch(void)
+{
+	static std::atomic<unsigned int> epoch(0);
+	return epoch;
+}
+template<class NodeType, class Allocator>
+std::atomic<typename EpochReclaim<NodeType, Allocator>::Record*>&
+	EpochReclaim<NodeType, Allocator>::getRecords(void)
+{
+	static std::atomic<Record*> records(nullptr);
+	return records;
+}
+template<class NodeType, class Allocator>
+std::mutex& EpochReclaim<NodeType, Allocator>::getOrphanLock(void)
+{
+	static std::mutex orphanLock;
+	return orphanLock;
+}
+template<class NodeType, class Allocator>
+std::vector<std::pair<unsigned int, NodeType*> >& EpochReclaim<NodeType, Allocator>::getOrphans(void)
+{
+	static std::vector<std::pair<unsigned int, NodeType*> > orphans;
+	return orphans;
+}
+// Walk the Records for one given up by an exited thread
+// If there is none, push a new Record onto the stack
+template<class NodeType, class Allocator>
+typename EpochReclaim<NodeType, Allocator>::Record*
+	EpochReclaim<NodeType, Allocator>::acquireRecord(void)
+{
+	std::atomic<Record*>& records = getRecords();
+	for (Record* curPtr = records.load(std::memory_order_acquire); curPtr != nullptr; curPtr = curPtr->next)
+	{
+		bool expected = false;
+		if (!curPtr->inUse.load(std::memory_order_relaxed) &&
+			curPtr->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+			return curPtr;
+	}
+	Record* newRecord = new Record;
+	newRecord->state.store(0, std::memory_order_relaxed);
+	newRecord->inUse.store(true, std::memory_order_relaxed);
+	newRecord->next = records.load(std::memory_order_relaxed);
+	while (!records.compare_exchange_weak(newRecord->next, newRecord,
+		std::memory_order_release, std::memory_order_relaxed));
+	return newRecord;
+}
+// Destroy each Node and hand its storage back to Allocator
+template<class NodeType, class Allocator>
+void EpochReclaim<NodeType, Allocator>::freeBag(std::vector<NodeType*>& aBag)
+{
+	for (std::size_t i = 0; i < aBag.size(); ++i)
+	{
+		aBag[i]->~NodeType();
+		Allocator::deallocate(aBag[i]);
+	}
+	aBag.clear();
+}
+// If any active thread is still in an older epoch, give up
+// Else step the epoch, unless another thread already did
+template<class NodeType, class Allocator>
+void EpochReclaim<NodeType, Allocator>::tryAdvance(unsigned int epoch)
+{
+	for (Record* curPtr = getRecords().load(std::memory_order_acquire); curPtr != nullptr; curPtr = curPtr->next)
+	{
+		unsigned int state = curPtr->state.load(std::memory_order_seq_cst);
+		if ((state & 1) != 0 && (state & ~1u) != epoch)
+			return;
+	}
+	getEpoch().compare_exchange_strong(epoch, epoch + 2, std::memory_order_seq_cst);
+}
+// A bag retired in epoch e is safe once the epoch reaches e + 4
+// (two steps of 2), every thread active then entered after e
+// Orphans are checked the same way
+template<class NodeType, class Allocator>
+void EpochReclaim<NodeType, Allocator>::collect(Local& aLocal, unsigned int epoch)
+{
+	for (int i = 0; i < 3; ++i)
+		if (!aLocal.bag[i].empty() && epoch - aLocal.bagEpoch[i] >= 4)
+			freeBag(aLocal.bag[i]);
+	std::vector<std::pair<unsigned int, NodeType*> >& orphans = getOrphans();
+	std::lock_guard<std::mutex> guard(getOrphanLock());
+	std::size_t kept = 0;
+	for (std::size_t i = 0; i < orphans.size(); ++i)
+	{
+		if (epoch - orphans[i].first >= 4)
+		{
+			orphans[i].second->~NodeType();
+			Allocator::deallocate(orphans[i].second);
+		}
+		else
+			orphans[kept++] = orphans[i];
+	}
+	orphans.resize(kept);
+}
+// Publish the global epoch with the active bit set
+// The store is seq_cst so a thread stepping the epoch can't miss it
+// If the epoch stepped before the store landed, publish again
+template<class NodeType, class Allocator>
+inline void EpochReclaim<NodeType, Allocator>::enter(void)
+{
+	Local& aLocal = local;
+	if (aLocal.depth++ != 0) return;
+	if (aLocal.record == nullptr)
+		aLocal.record = acquireRecord();
+	std::atomic<unsigned int>& globalEpoch = getEpoch();
+	unsigned int epoch;
+	do
+	{
+		epoch = globalEpoch.load(std::memory_order_seq_cst);
+		aLocal.record->state.store(epoch | 1, std::memory_order_seq_cst);
+	} while (globalEpoch.load(std::memory_order_seq_cst) != epoch);
+}
+template<class NodeType, class Allocator>
+inline void EpochReclaim<NodeType, Allocator>::leave(void)
+{
+	Local& aLocal = local;
+	if (--aLocal.depth == 0)
+		aLocal.record->state.store(0, std::memory_order_release);
+}
+// Bag the Node under the current epoch, freeing the bag first if it
+// still holds an old epoch's Nodes (three epochs back, so safe)
+// Once the bag is full, try to step the epoch and free old bags
+template<class NodeType, class Allocator>
+void EpochReclaim<NodeType, Allocator>::retire(NodeType* curPtr)
+{
+	Local& aLocal = local;
+	unsigned int epoch = getEpoch().load(std::memory_order_seq_cst);
+	int index = (epoch / 2) % 3;
+	if (aLocal.bagEpoch[index] != epoch)
+	{
+		if (!aLocal.bag[index].empty())
+			freeBag(aLocal.bag[index]);
+		aLocal.bagEpoch[index] = epoch;
+	}
+	aLocal.bag[index].push_back(curPtr);
+	if (int(aLocal.bag[index].size()) % Threshold == 0)
+	{
+		tryAdvance(epoch);
+		collect(aLocal, getEpoch().load(std::memory_order_seq_cst));
+	}
+}
+#endif
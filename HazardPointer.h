@@ -0,0 +1,220 @@
+/*
+* HazardPointer.h
+* Daniel Salazar
+* 10/18/2026
+* Hazard pointers for lock-free containers built from Nodes
+* A thread publishes the Node it is about to read in one of its
+* hazard slots, and a Node that has been unlinked is only
+* destroyed and handed back to Allocator once no slot holds it
+* That also rules out ABA: a Node a thread still looks at can't be
+* recycled and pushed back under the same address
+* HazardPointers<NodeType, Allocator, Slots> keeps one set of slots
+* per thread and one retired list per thread for each NodeType
+*/
+#ifndef HAZARDPOINTER_H
+#define HAZARDPOINTER_H
+#include <algorithm>	// sort, binary_search
+#include <atomic>		// atomic
+#include <cassert>		// assert
+#include <cstddef>		// size_t
+#include <mutex>		// mutex, lock_guard
+#include <vector>		// vector
+// Every member is static, like the allocator policies, so every
+// container of the same NodeType shares one set of slots per thread
+template<class NodeType, class Allocator, int Slots = 1>
+class HazardPointers
+{
+private:
+	// One thread's slots, never freed, reused once the thread exits
+	struct Record
+	{
+		std::atomic<NodeType*> hazard[Slots];
+		std::atomic<bool> active;
+		Record* next;
+	};
+	// Per thread state
+	struct Local
+	{
+		// This thread's slots, nullptr until first use
+		Record* record;
+		// Unlinked Nodes waiting for no slot to hold them
+		std::vector<NodeType*> retired;
+		// Hands leftovers to the orphan list
+		~Local();
+	};
+	static thread_local Local local;
+	// Stack of every Record ever made
+	static std::atomic<Record*>& getRecords(void);
+	// Count of Records, used to size the scan threshold
+	static std::atomic<int>& getRecordCount(void);
+	// Retired Nodes left behind by exited threads
+	static std::mutex& getOrphanLock(void);
+	static std::vector<NodeType*>& getOrphans(void);
+	// Claims a free Record or pushes a new one
+	static Record* acquireRecord(void);
+	// Destroys a Node and returns it to Allocator
+	static void reclaim(NodeType* curPtr);
+public:
+	// Loads src into slot until the slot and src agree
+	// The returned Node can't be reclaimed until slot is cleared
+	static NodeType* protect(int slot, const std::atomic<NodeType*>& src);
+	// Stops protecting slot's Node
+	static void clear(int slot);
+	// Takes over an unlinked Node and reclaims it once unprotected
+	// Scans once the retired list reaches the threshold
+	static void retire(NodeType* curPtr);
+	// Reclaims every retired Node no slot holds
+	static void scan(void);
+};
+// Each thread's state starts out empty
+template<class NodeType, class Allocator, int Slots>
+thread_local typename HazardPointers<NodeType, Allocator, Slots>::Local
+	HazardPointers<NodeType, Allocator, Slots>::local;
+// Clear this thread's slots so no one waits on them
+// Retired Nodes go to the orphan list for the next scan to adopt,
+// Allocator's per thread cache may already be gone at this point
+// Free up the Record for the next thread
+template<class NodeType, class Allocator, int Slots>
+HazardPointers<NodeType, Allocator, Slots>::Local::~Local()
+{
+	if (record == nullptr) return;
+	for (int i = 0; i < Slots; ++i)
+		record->hazard[i].store(nullptr, std::memory_order_release);
+	if (!retired.empty())
+	{
+		std::lock_guard<std::mutex> guard(getOrphanLock());
+		std::vector<NodeType*>& orphans = getOrphans();
+		orphans.insert(orphans.end(), retired.begin(), retired.end());
+		retired.clear();
+	}
+	record->active.store(false, std::memory_order_release);
+	record = nullptr;
+}
+// Function local statics so they exist before any thread uses them
+template<class NodeType, class Allocator, int Slots>
+std::atomic<typename HazardPointers<NodeType, Allocator, Slots>::Record*>&
+	HazardPointers<NodeType, Allocator, Slots>::getRecords(void)
+{
+	static std::atomic<Record*> records(nullptr);
+	return records;
+}
+template<class NodeType, class Allocator, int Slots>
+std::atomic<int>& HazardPointers<NodeType, Allocator, Slots>::getRecordCount(void)
+{
+	static std::atomic<int> recordCount(0);
+	return recordCount;
+}
+template<class NodeType, class Allocator, int Slots>
+std::mutex& HazardPointers<NodeType, Allocator, Slots>::getOrphanLock(void)
+{
+	static std::mutex orphanLock;
+	return orphanLock;
+}
+template<class NodeType, class Allocator, int Slots>
+std::vector<NodeType*>& HazardPointers<NodeType, Allocator, Slots>::getOrphans(void)
+{
+	static std::vector<NodeType*> orphans;
+	return orphans;
+}
+// Walk the Records for one given up by an exited thread
+// If there is none, push a new Record onto the stack
+template<class NodeType, class Allocator, int Slots>
+typename HazardPointers<NodeType, Allocator, Slots>::Record*
+	HazardPointers<NodeType, Allocator, Slots>::acquireRecord(void)
+{
+	std::atomic<Record*>& records = getRecords();
+	for (Record* curPtr = records.load(std::memory_order_acquire); curPtr != nullptr; curPtr = curPtr->next)
+	{
+		bool expected = false;
+		if (!curPtr->active.load(std::memory_order_relaxed) &&
+			curPtr->active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+			return curPtr;
+	}
+	Record* newRecord = new Record;
+	for (int i = 0; i < Slots; ++i)
+		newRecord->hazard[i].store(nullptr, std::memory_order_relaxed);
+	newRecord->active.store(true, std::memory_order_relaxed);
+	newRecord->next = records.load(std::memory_order_relaxed);
+	while (!records.compare_exchange_weak(newRecord->next, newRecord,
+		std::memory_order_release, std::memory_order_relaxed));
+	getRecordCount().fetch_add(1, std::memory_order_relaxed);
+	return newRecord;
+}
+// Destroy a retired Node and hand its storage back to Allocator
+template<class NodeType, class Allocator, int Slots>
+inline void HazardPointers<NodeType, Allocator, Slots>::reclaim(NodeType* curPtr)
+{
+	curPtr->~NodeType();
+	Allocator::deallocate(curPtr);
+}
+// Publish what src points at, then check src still points at it
+// If src moved on in between, the Node may already be retired,
+// so try again with the new value
+template<class NodeType, class Allocator, int Slots>
+NodeType* HazardPointers<NodeType, Allocator, Slots>::protect(int slot, const std::atomic<NodeType*>& src)
+{
+	assert((slot >= 0) && (slot < Slots));
+	Local& aLocal = local;
+	if (aLocal.record == nullptr)
+		aLocal.record = acquireRecord();
+	std::atomic<NodeType*>& hazard = aLocal.record->hazard[slot];
+	NodeType* curPtr = src.load(std::memory_order_relaxed), *checkPtr;
+	for (;;)
+	{
+		hazard.store(curPtr, std::memory_order_seq_cst);
+		checkPtr = src.load(std::memory_order_seq_cst);
+		if (checkPtr == curPtr) return curPtr;
+		curPtr = checkPtr;
+	}
+}
+template<class NodeType, class Allocator, int Slots>
+inline void HazardPointers<NodeType, Allocator, Slots>::clear(int slot)
+{
+	assert((slot >= 0) && (slot < Slots));
+	if (local.record != nullptr)
+		local.record->hazard[slot].store(nullptr, std::memory_order_release);
+}
+// Scan once there are about twice as many retired Nodes as slots,
+// so every scan reclaims at least half of what it looks at
+template<class NodeType, class Allocator, int Slots>
+void HazardPointers<NodeType, Allocator, Slots>::retire(NodeType* curPtr)
+{
+	Local& aLocal = local;
+	aLocal.retired.push_back(curPtr);
+	int threshold = 2 * Slots * getRecordCount().load(std::memory_order_relaxed);
+	if (int(aLocal.retired.size()) >= ((threshold > 64) ? threshold : 64))
+		scan();
+}
+// Adopt any orphaned Nodes
+// Collect every slot's Node and sort them
+// Reclaim each retired Node not among them, keep the rest
+template<class NodeType, class Allocator, int Slots>
+void HazardPointers<NodeType, Allocator, Slots>::scan(void)
+{
+	Local& aLocal = local;
+	{
+		std::lock_guard<std::mutex> guard(getOrphanLock());
+		std::vector<NodeType*>& orphans = getOrphans();
+		aLocal.retired.insert(aLocal.retired.end(), orphans.begin(), orphans.end());
+		orphans.clear();
+	}
+	std::vector<NodeType*> hazards;
+	for (Record* curPtr = getRecords().load(std::memory_order_acquire); curPtr != nullptr; curPtr = curPtr->next)
+		for (int i = 0; i < Slots; ++i)
+		{
+			NodeType* hazard = curPtr->hazard[i].load(std::memory_order_seq_cst);
+			if (hazard != nullptr)
+				hazards.push_back(hazard);
+		}
+	std::sort(hazards.begin(), hazards.end());
+	std::size_t kept = 0;
+	for (std::size_t i = 0; i < aLocal.retired.size(); ++i)
+	{
+		if (std::binary_search(hazards.begin(), hazards.end(), aLocal.retired[i]))
+			aLocal.retired[kept++] = aLocal.retired[i];
+		else
+			reclaim(aLocal.retired[i]);
+	}
+	aLocal.retired.resize(kept);
+}
+#endif
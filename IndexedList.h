@@ -0,0 +1,796 @@
+/*
+* IndexedList.h
+* Daniel Salazar
+* 10/18/2026
+* A linked list whose Nodes live in one growable pool and link to
+* each other by 32-bit index instead of by pointer
+* Items and links are kept in two parallel arrays, so a Node costs
+* sizeof(ItemType) + 4 bytes with no per-Node heap header: an int
+* takes 8 bytes instead of a 16 byte Node plus malloc's overhead
+* Removed slots are reset to ItemType(), releasing what the item
+* held, and chained into a free list and reused before the
+* pool grows; compact() repacks the pool in list order
+* The pool grows like a vector, so growing may move every item:
+* references and pointers to items don't survive an insert, but
+* iterators do, they hold an index
+* When no slot is free the pool is exactly the list's items, so
+* count, min, max and sum run SimdKernels over the whole pool
+* IndexedIterator<ItemType, ValueType> walks the list
+* IndexedList<ItemType> is the collection
+*/
+#ifndef INDEXEDLIST_H
+#define INDEXEDLIST_H
+#include "LinkedList.h"
+#include "SimdKernels.h"
+#include <cstdint>		// uint32_t
+#include <limits>		// numeric_limits
+#include <utility>		// forward, move, swap
+#include <vector>		// vector
+template<class ItemType> class IndexedList;
+// Forward iterator over an IndexedList
+// ValueType is ItemType for iterator, const ItemType for const_iterator
+template<class ItemType, class ValueType>
+class IndexedIterator
+{
+private:
+	// List walked, and the slot of the current item
+	IndexedList<ItemType>* list;
+	std::uint32_t index;
+	template<class, class> friend class IndexedIterator;
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef ItemType value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef ValueType* pointer;
+	typedef ValueType& reference;
+	// Singular iterator
+	IndexedIterator();
+	// Points at slot anIndex of aList (Nil is end)
+	IndexedIterator(IndexedList<ItemType>* aList, std::uint32_t anIndex);
+	// Copies an iterator, or converts iterator to const_iterator
+	IndexedIterator(const IndexedIterator<ItemType, ItemType>& anIter);
+	IndexedIterator<ItemType, ValueType>& operator=(const IndexedIterator<ItemType, ValueType>& anIter) = default;
+	// Current item
+	reference operator*() const;
+	pointer operator->() const;
+	// Steps to the next item
+	IndexedIterator<ItemType, ValueType>& operator++();
+	IndexedIterator<ItemType, ValueType> operator++(int);
+	// Iterators are equal when they point at the same slot
+	template<class OtherType>
+	bool operator==(const IndexedIterator<ItemType, OtherType>& rhs) const;
+	template<class OtherType>
+	bool operator!=(const IndexedIterator<ItemType, OtherType>& rhs) const;
+};
+// Linked List of pool slots
+// Non-const getEntry/setEntry move a cached cursor; const reads
+// write nothing, so threads may share one const list
+template<class ItemType>
+class IndexedList : public ListInterface<ItemType>
+{
+private:
+	// Index that links to nothing
+	static const std::uint32_t Nil = std::numeric_limits<std::uint32_t>::max();
+	// items[i] is slot i's item, links[i] the slot after it
+	// A free slot's link is the next free slot, its item is ItemType()
+	std::vector<ItemType> items;
+	std::vector<std::uint32_t> links;
+	// First and last slots of the list, Nil if empty
+	std::uint32_t head, tail;
+	// First free slot, Nil if none
+	std::uint32_t freeHead;
+	// Count of items in the list
+	int itemCount;
+	// Last slot getIndexAt found and its position, Nil/0 if unset
+	std::uint32_t cursor;
+	int cursorPos;
+	template<class, class> friend class IndexedIterator;
+	// Builds an item from args in a free slot, or a new one
+	template<class... Args>
+	std::uint32_t getSlot(Args&&... args);
+	// Chains a removed slot onto the free list
+	void freeSlot(std::uint32_t index);
+	// Slot after prev, head's slot when prev is Nil
+	std::uint32_t nextOf(std::uint32_t prev) const;
+	// Links index in after prev (or at the front when prev is Nil)
+	void linkAfter(std::uint32_t prev, std::uint32_t index);
+	// Unlinks the slot after prev (or the first), returns it
+	std::uint32_t unlinkAfter(std::uint32_t prev);
+	// Get/Set Entry helper function: returns the slot at position
+	// Resumes from and moves the cursor
+	std::uint32_t getIndexAt(int position);
+	// Same for const reads, walks from head and leaves the cursor alone
+	std::uint32_t findIndexAt(int position) const;
+	// Next getIndexAt starts over from head
+	void resetCursor(void);
+public:
+	typedef ItemType value_type;
+	// What sum returns, see KernelSum
+	typedef typename SimdKernels<ItemType>::SumType sum_type;
+	typedef IndexedIterator<ItemType, ItemType> iterator;
+	typedef IndexedIterator<ItemType, const ItemType> const_iterator;
+	// Default constructor
+	IndexedList();
+	// Copies aList in list order, packed
+	IndexedList(const IndexedList<ItemType>& aList);
+	// Copies the items of [first, last) in order
+	template<class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+	IndexedList(InputIt first, InputIt last);
+	// Copies the items of anInitList in order
+	IndexedList(std::initializer_list<ItemType> anInitList);
+	// Takes over aList's pool
+	IndexedList(IndexedList<ItemType>&& aList) noexcept;
+	// Assignment operator copies aList into thisList
+	IndexedList<ItemType>& operator=(const IndexedList<ItemType>& aList);
+	// Move assignment, takes over aList's pool
+	IndexedList<ItemType>& operator=(IndexedList<ItemType>&& aList) noexcept;
+	// Destructor
+	virtual ~IndexedList();
+	// Modify a specified item
+	void setEntry(int position, const ItemType& newEntry);
+	// Get a specified item by reference
+	const ItemType& getEntry(int position) const;
+	ItemType& getEntry(int position);
+	// First and last items, O(1)
+	ItemType& front(void);
+	const ItemType& front(void) const;
+	ItemType& back(void);
+	const ItemType& back(void) const;
+	// Get number of items in List
+	int getLength() const;
+	// Checks if itemCount is 0
+	bool isEmpty() const;
+	// Search a sorted List for anEntry, like LinkedList::isInList
+	bool isInList(const ItemType& anEntry) const;
+	// Search for item in a List in any order
+	bool contains(const ItemType& anEntry) const;
+	// Number of items equal to anEntry
+	long long count(const ItemType& anEntry) const;
+	// Least and greatest items, the List must not be empty
+	ItemType minItem(void) const;
+	ItemType maxItem(void) const;
+	// Sum of the items
+	sum_type sum(void) const;
+	// Inserts an item at position
+	void insert(int position, const ItemType& newEntry);
+	// Builds an item from args at position
+	template<class... Args>
+	void emplace(int position, Args&&... args);
+	// Inserts an item in ascending order, after equal items
+	void insertSorted(const ItemType& newEntry);
+	// Inserts an item at the beginning of List
+	void push(const ItemType& newEntry);
+	template<class... Args>
+	void emplace_front(Args&&... args);
+	// Inserts an item at the end of List in O(1)
+	void push_back(const ItemType& newEntry);
+	template<class... Args>
+	void emplace_back(Args&&... args);
+	// Removes the first item equal to anEntry
+	bool remove(const ItemType& anEntry);
+	// Removes the first item
+	bool pop();
+	// Removes all items and frees the pool
+	void clear(void);
+	// Makes room for len items without growing the pool again
+	void reserve(int len);
+	// Slots in the pool, used and free
+	int capacity(void) const;
+	// Repacks the pool in list order and drops free slots
+	void compact(void);
+	// Displays all items to stdout
+	void printList(int direction) const;
+	// Writes all items to os or out, separator between items,
+	// front to back if direction is Forward else back to front
+	void printList(std::ostream& os, int direction, const char* separator = "") const;
+	void printList(ListWriter& out, int direction, const char* separator = "") const;
+	// printList's direction variables
+	static int Forward;
+	static int Reverse;
+	// Copies aList's items to the end of thisList
+	IndexedList<ItemType>& append(const IndexedList<ItemType>& aList);
+	// Reverses in place, relinking slots without moving items
+	IndexedList<ItemType>& reverse(void);
+	// Iterator to the first item
+	iterator begin(void);
+	const_iterator begin(void) const;
+	const_iterator cbegin(void) const;
+	// Iterator past the last item
+	iterator end(void);
+	const_iterator end(void) const;
+	const_iterator cend(void) const;
+};
+template<class ItemType, class ValueType>
+inline IndexedIterator<ItemType, ValueType>::IndexedIterator() :
+	list(nullptr), index(IndexedList<ItemType>::Nil)
+{
+}
+template<class ItemType, class ValueType>
+inline IndexedIterator<ItemType, ValueType>::IndexedIterator(IndexedList<ItemType>* aList, std::uint32_t anIndex) :
+	list(aList), index(anIndex)
+{
+}
+template<class ItemType, class ValueType>
+inline IndexedIterator<ItemType, ValueType>::IndexedIterator(const IndexedIterator<ItemType, ItemType>& anIter) :
+	list(anIter.list), index(anIter.index)
+{
+}
+template<class ItemType, class ValueType>
+inline typename IndexedIterator<ItemType, ValueType>::reference
+	IndexedIterator<ItemType, ValueType>::operator*() const
+{
+	return list->items[index];
+}
+template<class ItemType, class ValueType>
+inline typename IndexedIterator<ItemType, ValueType>::pointer
+	IndexedIterator<ItemType, ValueType>::operator->() const
+{
+	return &list->items[index];
+}
+template<class ItemType, class ValueType>
+inline IndexedIterator<ItemType, ValueType>& IndexedIterator<ItemType, ValueType>::operator++()
+{
+	index = list->links[index];
+	return *this;
+}
+template<class ItemType, class ValueType>
+inline IndexedIterator<ItemType, ValueType> IndexedIterator<ItemType, ValueType>::operator++(int)
+{
+	IndexedIterator<ItemType, ValueType> prev(*this);
+	index = list->links[index];
+	return prev;
+}
+template<class ItemType, class ValueType>
+template<class OtherType>
+inline bool IndexedIterator<ItemType, ValueType>::operator==(const IndexedIterator<ItemType, OtherType>& rhs) const
+{
+	return index == rhs.index;
+}
+template<class ItemType, class ValueType>
+template<class OtherType>
+inline bool IndexedIterator<ItemType, ValueType>::operator!=(const IndexedIterator<ItemType, OtherType>& rhs) const
+{
+	return index != rhs.index;
+}
+// Nil is passed by reference to vector, so it needs a definition
+template<class ItemType>
+const std::uint32_t IndexedList<ItemType>::Nil;
+// Used with printList function
+template<class ItemType>
+int IndexedList<ItemType>::Forward = 1;
+template<class ItemType>
+int IndexedList<ItemType>::Reverse = -1;
+// Reuse the first free slot if there is one, else grow the pool
+template<class ItemType>
+template<class... Args>
+std::uint32_t IndexedList<ItemType>::getSlot(Args&&... args)
+{
+	std::uint32_t index = freeHead;
+	if (index != Nil)
+	{
+		freeHead = links[index];
+		items[index] = ItemType(std::forward<Args>(args)...);
+		links[index] = Nil;
+		return index;
+	}
+	assert(items.size() < Nil);
+	index = std::uint32_t(items.size());
+	items.emplace_back(std::forward<Args>(args)...);
+	links.push_back(Nil);
+	return index;
+}
+// Reset the item so whatever it holds is released now, not when
+// the slot is reused
+template<class ItemType>
+inline void IndexedList<ItemType>::freeSlot(std::uint32_t index)
+{
+	items[index] = ItemType();
+	links[index] = freeHead;
+	freeHead = index;
+}
+template<class ItemType>
+inline std::uint32_t IndexedList<ItemType>::nextOf(std::uint32_t prev) const
+{
+	return prev == Nil ? head : links[prev];
+}
+// If prev was the last slot (or the list was empty), index is the tail
+template<class ItemType>
+inline void IndexedList<ItemType>::linkAfter(std::uint32_t prev, std::uint32_t index)
+{
+	links[index] = nextOf(prev);
+	if (prev == Nil)
+		head = index;
+	else
+		links[prev] = index;
+	if (tail == prev)
+		tail = index;
+	++itemCount;
+}
+// If the slot was the tail, prev is the new tail
+template<class ItemType>
+inline std::uint32_t IndexedList<ItemType>::unlinkAfter(std::uint32_t prev)
+{
+	std::uint32_t index = nextOf(prev);
+	if (prev == Nil)
+		head = links[index];
+	else
+		links[prev] = links[index];
+	if (tail == index)
+		tail = prev;
+	--itemCount;
+	return index;
+}
+// Up to the user to enter a legal position
+// First and last slots are O(1)
+// If the cursor is at or before position, start from it
+// Else start from head
+// Skip down the List to the specified position, counting the steps
+// Remember it in the cursor and return its slot
+template<class ItemType>
+std::uint32_t IndexedList<ItemType>::getIndexAt(int position)
+{
+	assert((position >= 1) && (position <= itemCount));
+	if (position == 1 || position == itemCount)
+	{
+		ListStats::walked(0);
+		return position == 1 ? head : tail;
+	}
+	std::uint32_t index = head;
+	int skip = 1;
+	if (cursor != Nil && cursorPos <= position)
+	{
+		index = cursor;
+		skip = cursorPos;
+	}
+	ListStats::walked(position - skip);
+	for (; skip < position; ++skip)
+		index = links[index];
+	cursor = index;
+	cursorPos = position;
+	return index;
+}
+// Up to the user to enter a legal position
+// First and last slots are O(1)
+// Else skip down from head; nothing is written, so any number of
+// threads may look up a shared const List at once
+template<class ItemType>
+std::uint32_t IndexedList<ItemType>::findIndexAt(int position) const
+{
+	assert((position >= 1) && (position <= itemCount));
+	if (position == 1 || position == itemCount)
+	{
+		ListStats::walked(0);
+		return position == 1 ? head : tail;
+	}
+	std::uint32_t index = head;
+	ListStats::walked(position - 1);
+	for (int skip = 1; skip < position; ++skip)
+		index = links[index];
+	return index;
+}
+template<class ItemType>
+inline void IndexedList<ItemType>::resetCursor(void)
+{
+	cursor = Nil;
+	cursorPos = 0;
+}
+template<class ItemType>
+IndexedList<ItemType>::IndexedList() :
+	head(Nil), tail(Nil), freeHead(Nil), itemCount(0), cursor(Nil), cursorPos(0)
+{
+}
+// Start out empty, one reserve, then append
+template<class ItemType>
+IndexedList<ItemType>::IndexedList(const IndexedList<ItemType>& aList) :
+	head(Nil), tail(Nil), freeHead(Nil), itemCount(0), cursor(Nil), cursorPos(0)
+{
+	append(aList);
+	ListStats::copied(aList.itemCount);
+}
+// Start out empty
+// Build each item at the end of the pool and of the list
+template<class ItemType>
+template<class InputIt, class>
+IndexedList<ItemType>::IndexedList(InputIt first, InputIt last) :
+	head(Nil), tail(Nil), freeHead(Nil), itemCount(0), cursor(Nil), cursorPos(0)
+{
+	for (; first != last; ++first)
+		emplace_back(*first);
+}
+template<class ItemType>
+IndexedList<ItemType>::IndexedList(std::initializer_list<ItemType> anInitList) :
+	head(Nil), tail(Nil), freeHead(Nil), itemCount(0), cursor(Nil), cursorPos(0)
+{
+	reserve(int(anInitList.size()));
+	for (const ItemType& anItem : anInitList)
+		emplace_back(anItem);
+}
+// Takes aList's pool, ends and count
+// Leaves aList empty
+template<class ItemType>
+IndexedList<ItemType>::IndexedList(IndexedList<ItemType>&& aList) noexcept :
+	items(std::move(aList.items)), links(std::move(aList.links)), head(aList.head), tail(aList.tail),
+	freeHead(aList.freeHead), itemCount(aList.itemCount), cursor(Nil), cursorPos(0)
+{
+	aList.items.clear();
+	aList.links.clear();
+	aList.head = aList.tail = aList.freeHead = Nil;
+	aList.itemCount = 0;
+	aList.resetCursor();
+}
+// Clear thisList, then append a packed copy of aList
+template<class ItemType>
+IndexedList<ItemType>& IndexedList<ItemType>::operator=(const IndexedList<ItemType>& aList)
+{
+	if (this == &aList) return *this;
+	clear();
+	append(aList);
+	ListStats::copied(aList.itemCount);
+	return *this;
+}
+// Swap pools with aList, then empty aList
+template<class ItemType>
+IndexedList<ItemType>& IndexedList<ItemType>::operator=(IndexedList<ItemType>&& aList) noexcept
+{
+	if (this == &aList) return *this;
+	items.swap(aList.items);
+	links.swap(aList.links);
+	std::swap(head, aList.head);
+	std::swap(tail, aList.tail);
+	std::swap(freeHead, aList.freeHead);
+	std::swap(itemCount, aList.itemCount);
+	resetCursor();
+	aList.clear();
+	return *this;
+}
+template<class ItemType>
+IndexedList<ItemType>::~IndexedList()
+{
+}
+template<class ItemType>
+void IndexedList<ItemType>::setEntry(int position, const ItemType& newEntry)
+{
+	items[getIndexAt(position)] = newEntry;
+}
+template<class ItemType>
+const ItemType& IndexedList<ItemType>::getEntry(int position) const
+{
+	return items[findIndexAt(position)];
+}
+template<class ItemType>
+ItemType& IndexedList<ItemType>::getEntry(int position)
+{
+	return items[getIndexAt(position)];
+}
+// Up to the user to check the List isn't empty
+template<class ItemType>
+inline ItemType& IndexedList<ItemType>::front(void)
+{
+	assert(itemCount > 0);
+	return items[head];
+}
+template<class ItemType>
+inline const ItemType& IndexedList<ItemType>::front(void) const
+{
+	assert(itemCount > 0);
+	return items[head];
+}
+template<class ItemType>
+inline ItemType& IndexedList<ItemType>::back(void)
+{
+	assert(itemCount > 0);
+	return items[tail];
+}
+template<class ItemType>
+inline const ItemType& IndexedList<ItemType>::back(void) const
+{
+	assert(itemCount > 0);
+	return items[tail];
+}
+template<class ItemType>
+inline int IndexedList<ItemType>::getLength() const
+{
+	return itemCount;
+}
+template<class ItemType>
+inline bool IndexedList<ItemType>::isEmpty() const
+{
+	return itemCount == 0;
+}
+// Walk past every item less than anEntry, then check the next one
+template<class ItemType>
+bool IndexedList<ItemType>::isInList(const ItemType& anEntry) const
+{
+	std::uint32_t index = head;
+	while (index != Nil && items[index] < anEntry)
+		index = links[index];
+	return index != Nil && items[index] == anEntry;
+}
+// With no free slot every slot holds a list item, so order aside
+// the pool is the list: search it as one block
+// Else follow the links
+template<class ItemType>
+bool IndexedList<ItemType>::contains(const ItemType& anEntry) const
+{
+	if (freeHead == Nil)
+		return SimdKernels<ItemType>::find(items.data(), items.data() + items.size(), anEntry) != items.data() + items.size();
+	for (std::uint32_t index = head; index != Nil; index = links[index])
+		if (items[index] == anEntry) return true;
+	return false;
+}
+template<class ItemType>
+long long IndexedList<ItemType>::count(const ItemType& anEntry) const
+{
+	if (freeHead == Nil)
+		return SimdKernels<ItemType>::count(items.data(), items.data() + items.size(), anEntry);
+	long long total = 0;
+	for (std::uint32_t index = head; index != Nil; index = links[index])
+		if (items[index] == anEntry) ++total;
+	return total;
+}
+// Up to the user to check the List isn't empty
+template<class ItemType>
+ItemType IndexedList<ItemType>::minItem(void) const
+{
+	assert(itemCount > 0);
+	if (freeHead == Nil)
+		return SimdKernels<ItemType>::minItem(items.data(), items.data() + items.size());
+	ItemType least = items[head];
+	for (std::uint32_t index = links[head]; index != Nil; index = links[index])
+		if (items[index] < least) least = items[index];
+	return least;
+}
+template<class ItemType>
+ItemType IndexedList<ItemType>::maxItem(void) const
+{
+	assert(itemCount > 0);
+	if (freeHead == Nil)
+		return SimdKernels<ItemType>::maxItem(items.data(), items.data() + items.size());
+	ItemType greatest = items[head];
+	for (std::uint32_t index = links[head]; index != Nil; index = links[index])
+		if (greatest < items[index]) greatest = items[index];
+	return greatest;
+}
+template<class ItemType>
+typename IndexedList<ItemType>::sum_type IndexedList<ItemType>::sum(void) const
+{
+	if (freeHead == Nil)
+		return SimdKernels<ItemType>::sum(items.data(), items.data() + items.size());
+	sum_type total = sum_type();
+	for (std::uint32_t index = head; index != Nil; index = links[index])
+		total = total + items[index];
+	return total;
+}
+template<class ItemType>
+inline void IndexedList<ItemType>::insert(int position, const ItemType& newEntry)
+{
+	emplace(position, newEntry);
+}
+// Up to the user to enter a legal position
+// Build the item first, the pool may move while it grows
+// Link it after position - 1 (or at the front)
+// A cursor at or past position moves down one
+template<class ItemType>
+template<class... Args>
+void IndexedList<ItemType>::emplace(int position, Args&&... args)
+{
+	assert((position >= 1) && (position <= itemCount + 1));
+	std::uint32_t index = getSlot(std::forward<Args>(args)...);
+	linkAfter(position == 1 ? Nil : getIndexAt(position - 1), index);
+	if (cursor != Nil && cursorPos >= position)
+		++cursorPos;
+}
+// Items arriving in order go straight to the tail
+// Else walk past every item not greater than newEntry
+template<class ItemType>
+void IndexedList<ItemType>::insertSorted(const ItemType& newEntry)
+{
+	if (tail == Nil || !(newEntry < items[tail]))
+	{
+		push_back(newEntry);
+		return;
+	}
+	std::uint32_t prev = Nil, index = head;
+	while (index != Nil && !(newEntry < items[index]))
+	{
+		prev = index;
+		index = links[index];
+	}
+	std::uint32_t newIndex = getSlot(newEntry);
+	linkAfter(prev, newIndex);
+	resetCursor();
+}
+template<class ItemType>
+inline void IndexedList<ItemType>::push(const ItemType& newEntry)
+{
+	emplace_front(newEntry);
+}
+// Every cached position moves down one, so drop the cursor
+template<class ItemType>
+template<class... Args>
+void IndexedList<ItemType>::emplace_front(Args&&... args)
+{
+	linkAfter(Nil, getSlot(std::forward<Args>(args)...));
+	resetCursor();
+}
+template<class ItemType>
+inline void IndexedList<ItemType>::push_back(const ItemType& newEntry)
+{
+	emplace_back(newEntry);
+}
+template<class ItemType>
+template<class... Args>
+void IndexedList<ItemType>::emplace_back(Args&&... args)
+{
+	std::uint32_t index = getSlot(std::forward<Args>(args)...);
+	linkAfter(tail, index);
+}
+// Walk down the List keeping the slot before the current one
+// Unlink the first match and recycle its slot
+template<class ItemType>
+bool IndexedList<ItemType>::remove(const ItemType& anEntry)
+{
+	std::uint32_t prev = Nil, index = head;
+	while (index != Nil && !(items[index] == anEntry))
+	{
+		prev = index;
+		index = links[index];
+	}
+	if (index == Nil) return false;
+	freeSlot(unlinkAfter(prev));
+	resetCursor();
+	return true;
+}
+template<class ItemType>
+bool IndexedList<ItemType>::pop()
+{
+	if (itemCount == 0) return false;
+	freeSlot(unlinkAfter(Nil));
+	resetCursor();
+	return true;
+}
+// Dropping the arrays destroys every item
+template<class ItemType>
+void IndexedList<ItemType>::clear(void)
+{
+	std::vector<ItemType>().swap(items);
+	std::vector<std::uint32_t>().swap(links);
+	head = tail = freeHead = Nil;
+	itemCount = 0;
+	resetCursor();
+}
+template<class ItemType>
+void IndexedList<ItemType>::reserve(int len)
+{
+	items.reserve(len);
+	links.reserve(len);
+}
+template<class ItemType>
+inline int IndexedList<ItemType>::capacity(void) const
+{
+	return int(items.size());
+}
+// Move the items into new arrays in list order, so slot i holds
+// position i + 1 and every link points at the next slot
+template<class ItemType>
+void IndexedList<ItemType>::compact(void)
+{
+	std::vector<ItemType> packed;
+	std::vector<std::uint32_t> packedLinks;
+	packed.reserve(itemCount);
+	packedLinks.reserve(itemCount);
+	for (std::uint32_t index = head; index != Nil; index = links[index])
+	{
+		packed.push_back(std::move(items[index]));
+		packedLinks.push_back(std::uint32_t(packedLinks.size() + 1));
+	}
+	if (itemCount > 0)
+		packedLinks.back() = Nil;
+	items.swap(packed);
+	links.swap(packedLinks);
+	head = itemCount > 0 ? 0 : Nil;
+	tail = itemCount > 0 ? std::uint32_t(itemCount - 1) : Nil;
+	freeHead = Nil;
+	resetCursor();
+}
+// Forward prints items back to back, Reverse a space after each,
+// through a buffer on stdout
+template<class ItemType>
+void IndexedList<ItemType>::printList(int direction) const
+{
+	ListWriter out(std::cout);
+	printList(out, direction, direction == Forward ? "" : " ");
+	if (direction != Forward && itemCount > 0) out << ' ';
+}
+template<class ItemType>
+void IndexedList<ItemType>::printList(std::ostream& os, int direction, const char* separator) const
+{
+	ListWriter out(os);
+	printList(out, direction, separator);
+}
+// Forward follows the links
+// Reverse gathers the slots in list order, 4 bytes each, and
+// writes them back to front
+template<class ItemType>
+void IndexedList<ItemType>::printList(ListWriter& out, int direction, const char* separator) const
+{
+	std::vector<std::uint32_t> order;
+	if (direction != Forward)
+		order.reserve(itemCount);
+	for (std::uint32_t index = head; index != Nil; index = links[index])
+	{
+		if (direction != Forward)
+			order.push_back(index);
+		else
+		{
+			if (index != head) out << separator;
+			out << items[index];
+		}
+	}
+	for (int i = int(order.size()) - 1; i >= 0; --i)
+	{
+		out << items[order[i]];
+		if (i > 0) out << separator;
+	}
+}
+// Pools can't share slots, so copy aList's items onto the tail
+// after one reserve; aList may be thisList
+template<class ItemType>
+IndexedList<ItemType>& IndexedList<ItemType>::append(const IndexedList<ItemType>& aList)
+{
+	int count = aList.itemCount;
+	reserve(int(items.size()) + count);
+	std::uint32_t index = aList.head;
+	for (int i = 0; i < count; ++i, index = aList.links[index])
+		emplace_back(aList.items[index]);
+	return *this;
+}
+// Walk the List once, pointing each link back at the slot before it
+// The old head is the new tail
+template<class ItemType>
+IndexedList<ItemType>& IndexedList<ItemType>::reverse(void)
+{
+	std::uint32_t prev = Nil, index = head, next;
+	tail = head;
+	while (index != Nil)
+	{
+		next = links[index];
+		links[index] = prev;
+		prev = index;
+		index = next;
+	}
+	head = prev;
+	resetCursor();
+	return *this;
+}
+template<class ItemType>
+inline typename IndexedList<ItemType>::iterator IndexedList<ItemType>::begin(void)
+{
+	return iterator(this, head);
+}
+template<class ItemType>
+inline typename IndexedList<ItemType>::const_iterator IndexedList<ItemType>::begin(void) const
+{
+	return const_iterator(const_cast<IndexedList<ItemType>*>(this), head);
+}
+template<class ItemType>
+inline typename IndexedList<ItemType>::const_iterator IndexedList<ItemType>::cbegin(void) const
+{
+	return begin();
+}
+template<class ItemType>
+inline typename IndexedList<ItemType>::iterator IndexedList<ItemType>::end(void)
+{
+	return iterator(this, Nil);
+}
+template<class ItemType>
+inline typename IndexedList<ItemType>::const_iterator IndexedList<ItemType>::end(void) const
+{
+	return const_iterator(const_cast<IndexedList<ItemType>*>(this), Nil);
+}
+template<class ItemType>
+inline typename IndexedList<ItemType>::const_iterator IndexedList<ItemType>::cend(void) const
+{
+	return end();
+}
+#endif
@@ -0,0 +1,439 @@
+/*
+* IntrusiveList.h
+* Daniel Salazar
+* 10/18/2026
+* An intrusive singly linked list: the link lives inside the user's
+* own objects, so linking and unlinking never allocates or copies
+* An object carries a ListHook, either as a base class (BaseHook)
+* or as a data member (MemberHook), and the List strings objects
+* together through it
+* The List never owns its objects: they must outlive their time in
+* the List, and clear/pop/remove only unlink them
+* An object can be in one List per hook it carries
+* ListHook<Tag> is the embedded link
+* IntrusiveList<ItemType, HookTraits> is the collection
+*/
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+#include <cassert>		// assert
+#include <cstddef>		// ptrdiff_t, size_t
+#include <iostream>		// cout
+#include <iterator>		// forward_iterator_tag
+// The link embedded in an object
+// Tag tells apart the hooks of an object that is in several Lists
+template<class Tag = void>
+class ListHook
+{
+private:
+	ListHook<Tag>* next;
+public:
+	// Unlinked Hook
+	ListHook();
+	// Copying an object doesn't copy its place in a List
+	ListHook(const ListHook<Tag>& aHook);
+	ListHook<Tag>& operator=(const ListHook<Tag>& aHook);
+	// Sets Hook's nextPtr
+	void setNext(ListHook<Tag>* nextHookPtr);
+	// Get Hook's nextPtr
+	ListHook<Tag>* getNext() const;
+};
+template<class Tag>
+inline ListHook<Tag>::ListHook() : next(nullptr)
+{
+}
+template<class Tag>
+inline ListHook<Tag>::ListHook(const ListHook<Tag>& aHook) : next(nullptr)
+{
+	(void)aHook;
+}
+template<class Tag>
+inline ListHook<Tag>& ListHook<Tag>::operator=(const ListHook<Tag>& aHook)
+{
+	(void)aHook;
+	return *this;
+}
+template<class Tag>
+inline void ListHook<Tag>::setNext(ListHook<Tag>* nextHookPtr)
+{
+	next = nextHookPtr;
+}
+template<class Tag>
+inline ListHook<Tag>* ListHook<Tag>::getNext() const
+{
+	return next;
+}
+// ItemType derives from ListHook<Tag>
+template<class ItemType, class Tag = void>
+struct BaseHook
+{
+	typedef ListHook<Tag> HookType;
+	static HookType* toHook(ItemType* anItem) { return anItem; }
+	static ItemType* toItem(HookType* aHook) { return static_cast<ItemType*>(aHook); }
+};
+// ItemType has a ListHook<Tag> data member, Member points at it
+template<class ItemType, class Tag, ListHook<Tag> ItemType::* Member>
+struct MemberHook
+{
+	typedef ListHook<Tag> HookType;
+	static HookType* toHook(ItemType* anItem) { return &(anItem->*Member); }
+	// Step back from the Hook by the Member's offset in ItemType
+	static ItemType* toItem(HookType* aHook)
+	{
+		const ItemType* probe = reinterpret_cast<const ItemType*>(aHook);
+		std::ptrdiff_t offset = reinterpret_cast<const char*>(&(probe->*Member)) -
+			reinterpret_cast<const char*>(probe);
+		return reinterpret_cast<ItemType*>(reinterpret_cast<char*>(aHook) - offset);
+	}
+};
+// Forward iterator over the objects of an IntrusiveList
+// ValueType is ItemType for iterator, const ItemType for const_iterator
+template<class ItemType, class HookTraits, class ValueType>
+class IntrusiveIterator
+{
+private:
+	typedef typename HookTraits::HookType HookType;
+	HookType* curPtr;
+	template<class, class, class> friend class IntrusiveIterator;
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef ItemType value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef ValueType* pointer;
+	typedef ValueType& reference;
+	// Points at hookPtr's object (nullptr is end)
+	explicit IntrusiveIterator(HookType* hookPtr = nullptr);
+	// Copies an iterator, or converts iterator to const_iterator
+	IntrusiveIterator(const IntrusiveIterator<ItemType, HookTraits, ItemType>& anIter);
+	IntrusiveIterator<ItemType, HookTraits, ValueType>& operator=(const IntrusiveIterator<ItemType, HookTraits, ValueType>& anIter) = default;
+	// Current object
+	reference operator*() const;
+	pointer operator->() const;
+	// Steps to the next object
+	IntrusiveIterator<ItemType, HookTraits, ValueType>& operator++();
+	IntrusiveIterator<ItemType, HookTraits, ValueType> operator++(int);
+	// Iterators are equal when they point at the same object
+	template<class OtherType>
+	bool operator==(const IntrusiveIterator<ItemType, HookTraits, OtherType>& rhs) const;
+	template<class OtherType>
+	bool operator!=(const IntrusiveIterator<ItemType, HookTraits, OtherType>& rhs) const;
+};
+template<class ItemType, class HookTraits, class ValueType>
+inline IntrusiveIterator<ItemType, HookTraits, ValueType>::IntrusiveIterator(HookType* hookPtr) :
+	curPtr(hookPtr)
+{
+}
+template<class ItemType, class HookTraits, class ValueType>
+inline IntrusiveIterator<ItemType, HookTraits, ValueType>::IntrusiveIterator(const IntrusiveIterator<ItemType, HookTraits, ItemType>& anIter) :
+	curPtr(anIter.curPtr)
+{
+}
+template<class ItemType, class HookTraits, class ValueType>
+inline typename IntrusiveIterator<ItemType, HookTraits, ValueType>::reference
+	IntrusiveIterator<ItemType, HookTraits, ValueType>::operator*() const
+{
+	return *HookTraits::toItem(curPtr);
+}
+template<class ItemType, class HookTraits, class ValueType>
+inline typename IntrusiveIterator<ItemType, HookTraits, ValueType>::pointer
+	IntrusiveIterator<ItemType, HookTraits, ValueType>::operator->() const
+{
+	return HookTraits::toItem(curPtr);
+}
+template<class ItemType, class HookTraits, class ValueType>
+inline IntrusiveIterator<ItemType, HookTraits, ValueType>& IntrusiveIterator<ItemType, HookTraits, ValueType>::operator++()
+{
+	curPtr = curPtr->getNext();
+	return *this;
+}
+template<class ItemType, class HookTraits, class ValueType>
+inline IntrusiveIterator<ItemType, HookTraits, ValueType> IntrusiveIterator<ItemType, HookTraits, ValueType>::operator++(int)
+{
+	IntrusiveIterator<ItemType, HookTraits, ValueType> prev(*this);
+	curPtr = curPtr->getNext();
+	return prev;
+}
+template<class ItemType, class HookTraits, class ValueType>
+template<class OtherType>
+inline bool IntrusiveIterator<ItemType, HookTraits, ValueType>::operator==(const IntrusiveIterator<ItemType, HookTraits, OtherType>& rhs) const
+{
+	return curPtr == rhs.curPtr;
+}
+template<class ItemType, class HookTraits, class ValueType>
+template<class OtherType>
+inline bool IntrusiveIterator<ItemType, HookTraits, ValueType>::operator!=(const IntrusiveIterator<ItemType, HookTraits, OtherType>& rhs) const
+{
+	return curPtr != rhs.curPtr;
+}
+// Intrusive List of objects
+// Every operation only rewires Hooks, none allocates, copies or frees
+template<class ItemType, class HookTraits = BaseHook<ItemType> >
+class IntrusiveList
+{
+private:
+	typedef typename HookTraits::HookType HookType;
+	// head.getNext() points to nullptr/First Hook
+	HookType head;
+	// Points to head/Last Hook
+	HookType* tailPtr;
+	// Count of objects
+	int itemCount;
+	// Not copyable, an object can only be in one List per Hook
+	IntrusiveList(const IntrusiveList<ItemType, HookTraits>& aList);
+	IntrusiveList<ItemType, HookTraits>& operator=(const IntrusiveList<ItemType, HookTraits>& aList);
+public:
+	typedef IntrusiveIterator<ItemType, HookTraits, ItemType> iterator;
+	typedef IntrusiveIterator<ItemType, HookTraits, const ItemType> const_iterator;
+	// Default constructor
+	IntrusiveList();
+	// Takes over aList's objects, aList is left empty
+	IntrusiveList(IntrusiveList<ItemType, HookTraits>&& aList) noexcept;
+	IntrusiveList<ItemType, HookTraits>& operator=(IntrusiveList<ItemType, HookTraits>&& aList) noexcept;
+	// Destructor, unlinks every object
+	~IntrusiveList();
+	// First and last objects, O(1)
+	ItemType& front(void);
+	const ItemType& front(void) const;
+	ItemType& back(void);
+	const ItemType& back(void) const;
+	// Get number of objects in List
+	int getLength() const;
+	// Checks if itemCount is 0
+	bool isEmpty() const;
+	// Sequential search for an object equal to anEntry
+	bool isInList(const ItemType& anEntry) const;
+	// Links anItem at the beginning of List
+	void push(ItemType& anItem);
+	// Links anItem at the end of List in O(1)
+	void push_back(ItemType& anItem);
+	// Links anItem in ascending order by operator<, after equal objects
+	void insertSorted(ItemType& anItem);
+	// Unlinks the first object, nullptr if List was empty
+	ItemType* pop();
+	// Unlinks anItem itself, false if it isn't in thisList
+	bool remove(ItemType& anItem);
+	// Unlinks every object
+	void clear(void);
+	// Reverses in place
+	IntrusiveList<ItemType, HookTraits>& reverse(void);
+	// Moves aList's objects to the end of thisList in O(1)
+	IntrusiveList<ItemType, HookTraits>& append(IntrusiveList<ItemType, HookTraits>& aList);
+	// Displays all objects to stdout
+	void printList(void) const;
+	// Iterator to the first object
+	iterator begin(void);
+	const_iterator begin(void) const;
+	// Iterator past the last object
+	iterator end(void);
+	const_iterator end(void) const;
+};
+template<class ItemType, class HookTraits>
+IntrusiveList<ItemType, HookTraits>::IntrusiveList() : head(), tailPtr(&head), itemCount(0)
+{
+}
+// Takes aList's chain, tail and count
+// Leaves aList empty
+template<class ItemType, class HookTraits>
+IntrusiveList<ItemType, HookTraits>::IntrusiveList(IntrusiveList<ItemType, HookTraits>&& aList) noexcept :
+	head(), tailPtr(&head), itemCount(0)
+{
+	append(aList);
+}
+// Unlinks thisList's objects
+// Takes aList's chain, tail and count
+template<class ItemType, class HookTraits>
+IntrusiveList<ItemType, HookTraits>& IntrusiveList<ItemType, HookTraits>::operator=(IntrusiveList<ItemType, HookTraits>&& aList) noexcept
+{
+	if (this == &aList) return *this;
+	clear();
+	append(aList);
+	return *this;
+}
+template<class ItemType, class HookTraits>
+IntrusiveList<ItemType, HookTraits>::~IntrusiveList()
+{
+	clear();
+}
+// Up to the user to check the List isn't empty
+template<class ItemType, class HookTraits>
+inline ItemType& IntrusiveList<ItemType, HookTraits>::front(void)
+{
+	assert(itemCount > 0);
+	return *HookTraits::toItem(head.getNext());
+}
+template<class ItemType, class HookTraits>
+inline const ItemType& IntrusiveList<ItemType, HookTraits>::front(void) const
+{
+	assert(itemCount > 0);
+	return *HookTraits::toItem(head.getNext());
+}
+template<class ItemType, class HookTraits>
+inline ItemType& IntrusiveList<ItemType, HookTraits>::back(void)
+{
+	assert(itemCount > 0);
+	return *HookTraits::toItem(tailPtr);
+}
+template<class ItemType, class HookTraits>
+inline const ItemType& IntrusiveList<ItemType, HookTraits>::back(void) const
+{
+	assert(itemCount > 0);
+	return *HookTraits::toItem(tailPtr);
+}
+template<class ItemType, class HookTraits>
+inline int IntrusiveList<ItemType, HookTraits>::getLength() const
+{
+	return itemCount;
+}
+template<class ItemType, class HookTraits>
+inline bool IntrusiveList<ItemType, HookTraits>::isEmpty() const
+{
+	return itemCount == 0;
+}
+template<class ItemType, class HookTraits>
+bool IntrusiveList<ItemType, HookTraits>::isInList(const ItemType& anEntry) const
+{
+	for (const_iterator curIter = begin(); curIter != end(); ++curIter)
+		if (*curIter == anEntry) return true;
+	return false;
+}
+// Link anItem's Hook between head and the first Hook
+template<class ItemType, class HookTraits>
+inline void IntrusiveList<ItemType, HookTraits>::push(ItemType& anItem)
+{
+	HookType* hookPtr = HookTraits::toHook(&anItem);
+	hookPtr->setNext(head.getNext());
+	head.setNext(hookPtr);
+	if (tailPtr == &head) tailPtr = hookPtr;
+	++itemCount;
+}
+// Link anItem's Hook after tailPtr (head if empty)
+template<class ItemType, class HookTraits>
+inline void IntrusiveList<ItemType, HookTraits>::push_back(ItemType& anItem)
+{
+	HookType* hookPtr = HookTraits::toHook(&anItem);
+	hookPtr->setNext(nullptr);
+	tailPtr->setNext(hookPtr);
+	tailPtr = hookPtr;
+	++itemCount;
+}
+// Objects arriving in order go straight to the tail
+// Else inchworm down the List past every object not greater
+// than anItem, and link anItem there
+template<class ItemType, class HookTraits>
+void IntrusiveList<ItemType, HookTraits>::insertSorted(ItemType& anItem)
+{
+	if (tailPtr == &head || !(anItem < *HookTraits::toItem(tailPtr)))
+	{
+		push_back(anItem);
+		return;
+	}
+	HookType* prevPtr = &head;
+	while (prevPtr->getNext() != nullptr && !(anItem < *HookTraits::toItem(prevPtr->getNext())))
+		prevPtr = prevPtr->getNext();
+	HookType* hookPtr = HookTraits::toHook(&anItem);
+	hookPtr->setNext(prevPtr->getNext());
+	prevPtr->setNext(hookPtr);
+	++itemCount;
+}
+// Unlink the first Hook and hand back its object
+template<class ItemType, class HookTraits>
+ItemType* IntrusiveList<ItemType, HookTraits>::pop()
+{
+	HookType* hookPtr = head.getNext();
+	if (hookPtr == nullptr) return nullptr;
+	head.setNext(hookPtr->getNext());
+	if (tailPtr == hookPtr) tailPtr = &head;
+	hookPtr->setNext(nullptr);
+	--itemCount;
+	return HookTraits::toItem(hookPtr);
+}
+// Inchworm down the List looking for anItem's own Hook
+// Unlink it, if it was last prevPtr is the new tail
+template<class ItemType, class HookTraits>
+bool IntrusiveList<ItemType, HookTraits>::remove(ItemType& anItem)
+{
+	HookType* hookPtr = HookTraits::toHook(&anItem);
+	HookType* prevPtr = &head;
+	while (prevPtr->getNext() != nullptr && prevPtr->getNext() != hookPtr)
+		prevPtr = prevPtr->getNext();
+	if (prevPtr->getNext() == nullptr) return false;
+	prevPtr->setNext(hookPtr->getNext());
+	if (tailPtr == hookPtr) tailPtr = prevPtr;
+	hookPtr->setNext(nullptr);
+	--itemCount;
+	return true;
+}
+// Reset every Hook so no object looks linked, then empty thisList
+template<class ItemType, class HookTraits>
+void IntrusiveList<ItemType, HookTraits>::clear(void)
+{
+	HookType* curPtr = head.getNext(), *nextPtr;
+	while (curPtr != nullptr)
+	{
+		nextPtr = curPtr->getNext();
+		curPtr->setNext(nullptr);
+		curPtr = nextPtr;
+	}
+	head.setNext(nullptr);
+	tailPtr = &head;
+	itemCount = 0;
+}
+// Walk thisList once, pointing each Hook back at the one before it
+// The old first Hook is the new tail
+template<class ItemType, class HookTraits>
+IntrusiveList<ItemType, HookTraits>& IntrusiveList<ItemType, HookTraits>::reverse(void)
+{
+	if (itemCount < 2) return *this;
+	HookType* curPtr = head.getNext(), *prevPtr = nullptr, *nextPtr;
+	tailPtr = curPtr;
+	while (curPtr != nullptr)
+	{
+		nextPtr = curPtr->getNext();
+		curPtr->setNext(prevPtr);
+		prevPtr = curPtr;
+		curPtr = nextPtr;
+	}
+	head.setNext(prevPtr);
+	return *this;
+}
+// Link aList's chain after tailPtr and take its tail and count
+// Leaves aList empty
+template<class ItemType, class HookTraits>
+IntrusiveList<ItemType, HookTraits>& IntrusiveList<ItemType, HookTraits>::append(IntrusiveList<ItemType, HookTraits>& aList)
+{
+	assert(this != &aList);
+	if (aList.itemCount == 0) return *this;
+	tailPtr->setNext(aList.head.getNext());
+	tailPtr = aList.tailPtr;
+	itemCount += aList.itemCount;
+	aList.head.setNext(nullptr);
+	aList.tailPtr = &aList.head;
+	aList.itemCount = 0;
+	return *this;
+}
+template<class ItemType, class HookTraits>
+void IntrusiveList<ItemType, HookTraits>::printList(void) const
+{
+	for (const_iterator curIter = begin(); curIter != end(); ++curIter)
+		std::cout << *curIter;
+}
+template<class ItemType, class HookTraits>
+inline typename IntrusiveList<ItemType, HookTraits>::iterator IntrusiveList<ItemType, HookTraits>::begin(void)
+{
+	return iterator(head.getNext());
+}
+template<class ItemType, class HookTraits>
+inline typename IntrusiveList<ItemType, HookTraits>::const_iterator IntrusiveList<ItemType, HookTraits>::begin(void) const
+{
+	return const_iterator(head.getNext());
+}
+template<class ItemType, class HookTraits>
+inline typename IntrusiveList<ItemType, HookTraits>::iterator IntrusiveList<ItemType, HookTraits>::end(void)
+{
+	return iterator(nullptr);
+}
+template<class ItemType, class HookTraits>
+inline typename IntrusiveList<ItemType, HookTraits>::const_iterator IntrusiveList<ItemType, HookTraits>::end(void) const
+{
+	return const_iterator(nullptr);
+}
+#endif
@@ -0,0 +1,67 @@
+/*
+* LayoutBench.cpp
+* Daniel Salazar
+* 10/18/2026
+* Microbenchmark of long LinkedList walks once the List is bigger
+* than the last level cache
+* Builds a List of n ints whose Nodes are scattered through memory
+* (built in shuffled order, then sorted, so list order jumps between
+* addresses), times full walks of isInList, remove, getEntry and
+* insertSorted, then compact()s the List and times them again
+* Usage: LayoutBench [n] [walks]
+*/
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "LinkedList.h"
+// Written once per layout so the walks can't be optimized away
+static volatile long long sink = 0;
+// Runs walk reps times and returns ns per Node visited
+template<class Walk>
+double nsPerNode(Walk walk, int reps, long long nodesPerWalk)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int i = 0; i < reps; ++i)
+		walk();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return seconds * 1e9 / (double(reps) * nodesPerWalk);
+}
+// Every walk below goes the whole length of the List
+void benchWalks(LinkedList<int>& list, int n, int reps, const char* layout)
+{
+	long long found = 0;
+	double search = nsPerNode([&]() { found += list.isInList(n); }, reps, n);
+	double removal = nsPerNode([&]() { found += list.remove(-1); }, reps, n);
+	// getEntry(2) leaves the cursor near the front, so getEntry(n - 1)
+	// walks from there to the end
+	double positional = nsPerNode([&]() { found += list.getEntry(2) + list.getEntry(n - 1); }, reps, n);
+	// Equal to the last item, so it goes in just before it after a full
+	// walk, and remove finds it after another
+	double sorted = nsPerNode([&]() { list.insertSorted(n - 1); found += list.remove(n - 1); }, reps, 2LL * n);
+	std::printf("%-10s%14.2f%14.2f%14.2f%14.2f\n", layout, search, removal, positional, sorted);
+	sink = found;
+}
+int main(int argc, char* argv[])
+{
+	int n = (argc > 1) ? std::atoi(argv[1]) : 1 << 24;
+	int reps = (argc > 2) ? std::atoi(argv[2]) : 3;
+	std::vector<int> values(n);
+	std::iota(values.begin(), values.end(), 0);
+	std::shuffle(values.begin(), values.end(), std::mt19937(1));
+	LinkedList<int> list(values.begin(), values.end());
+	std::vector<int>().swap(values);
+	list.sort();
+	std::printf("n = %d, ns per Node visited\n", n);
+	std::printf("%-10s%14s%14s%14s%14s\n", "layout", "isInList", "remove", "getEntry", "insertSorted");
+	benchWalks(list, n, reps, "scattered");
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	list.compact();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	benchWalks(list, n, reps, "compacted");
+	std::printf("compact took %.2f s\n", seconds);
+	return 0;
+}
@@ -5,61 +5,136 @@
 * A container of items organized in ascending order
 * ItemType can be char, int, float, or double
 * Node<ItemType> is the List Element
-* LinkedList<ItemType> is the collection of Nodes
+* LinkedList<ItemType, Allocator> is the collection of Nodes
+* Allocator is the policy Nodes are created with (NodeAllocator.h)
+* Define LINKEDLIST_STATS to count allocations, positional walks
+* and copies in ListStats (ListStats.h)
 */
+#ifndef LINKEDLIST_H
+#define LINKEDLIST_H
+#include <algorithm>	// sort
 #include <cassert>		// assert
+#include <cstddef>		// ptrdiff_t
+#include <functional>	// less
+#include <initializer_list>	// initializer_list
 #include <iostream>		// cin, cout, endl, flush
+#include <iterator>		// forward_iterator_tag, iterator_traits, distance
+#include <new>			// placement new
+#include <utility>		// forward, move
+#include <vector>		// vector
+#include "NodeAllocator.h"
+#include "ListWriter.h"
 // Abstract base classes
 template<class ItemType>
 class ListInterface
 {
 public:
 	virtual void setEntry(int position, const ItemType& newEntry) = 0;
-	virtual ItemType getEntry(int position) const = 0;
+	virtual const ItemType& getEntry(int position) const = 0;
 	virtual void insert(int position, const ItemType& newEntry) = 0;
 	virtual bool remove(const ItemType & newEntry) = 0;
 	virtual bool isEmpty() const = 0;
 	virtual int getLength() const = 0;
 	virtual void clear() = 0;
 };
+template<class ItemType> class Node;
+template<class ItemType, class ValueType> class ListIterator;
+// The link at the start of every Node
+// A list's head is a bare NodeBase, so the front of the list
+// can be handled like any other Node's next
+template<class ItemType>
+class NodeBase
+{
+protected:
+	Node<ItemType>* next;
+public:
+	// Default Constructor
+	NodeBase();
+	// next Copy Constructor
+	NodeBase(Node<ItemType>* nextNodePtr);
+	// Sets Node's nextPtr
+	void setNext(Node<ItemType>* nextNodePtr);
+	// Get Node's nextPtr
+	Node<ItemType>* getNext() const;
+};
 // A container class that holds a variable
 template<class ItemType>
-class Node
+class Node : public NodeBase<ItemType>
 {
 private:
 	ItemType item;
-	Node<ItemType>* next;
+	// Iterators read item directly
+	template<class, class> friend class ListIterator;
 public:
 	// Default Constructor
 	Node();
 	// item Copy Constructor
 	Node(const ItemType& anItem);
+	// item Move Constructor
+	Node(ItemType&& anItem);
 	// item/next Copy Constructor
 	Node(const ItemType& anItem, Node<ItemType>* nextNodePtr);
+	// Builds item in place from args
+	template<class... Args>
+	Node(Node<ItemType>* nextNodePtr, Args&&... args);
 	// Sets Node's item
 	void setItem(const ItemType& anItem);
-	// Sets Node's nextPtr
-	void setNext(Node<ItemType>* nextNodePtr);
+	// Moves anItem into Node's item
+	void setItem(ItemType&& anItem);
 	// Get Node's Item
-	ItemType getItem() const;
-	// Get Node's nextPtr
-	Node<ItemType>* getNext() const;
+	const ItemType& getItem() const;
+	ItemType& getItem();
 };
+// Initializes an unlinked NodeBase
+template<class ItemType>
+NodeBase<ItemType>::NodeBase() : next(nullptr)
+{
+}
+// Copies nextNodePtr to this NodeBase's next
+template<class ItemType>
+NodeBase<ItemType>::NodeBase(Node<ItemType>* nextNodePtr) : next(nextNodePtr)
+{
+}
+// Replaces this Node's next with nextNodePtr
+template<class ItemType>
+inline void NodeBase<ItemType>::setNext(Node<ItemType>* nextNodePtr)
+{
+	next = nextNodePtr;
+}
+// Assists List with access to next
+template<class ItemType>
+inline Node<ItemType>* NodeBase<ItemType>::getNext() const
+{
+	return next;
+}
 // Initializes a new Node
 template<class ItemType>
-Node<ItemType>::Node() : next(nullptr)
+Node<ItemType>::Node() : NodeBase<ItemType>(nullptr), item()
 {
 }
 // Copies anItem to this Node's item
 template<class ItemType>
-Node<ItemType>::Node(const ItemType& anItem) : item(anItem), next(nullptr)
+Node<ItemType>::Node(const ItemType& anItem) : NodeBase<ItemType>(nullptr), item(anItem)
+{
+}
+// Moves anItem into this Node's item
+template<class ItemType>
+Node<ItemType>::Node(ItemType&& anItem) : NodeBase<ItemType>(nullptr), item(std::move(anItem))
 {
 }
 // Copies anItem to this Node's item
 // Copies nextNodePtr to this Node's next
 template<class ItemType>
 Node<ItemType>::Node(const ItemType& anItem, Node<ItemType>* nextNodePtr) :
-	item(anItem), next(nextNodePtr)
+	NodeBase<ItemType>(nextNodePtr), item(anItem)
+{
+}
+// Forwards args to item's constructor
+// Copies nextNodePtr to this Node's next
+template<class ItemType>
+template<class... Args>
+Node<ItemType>::Node(Node<ItemType>* nextNodePtr, Args&&... args) :
+	NodeBase<ItemType>(nextNodePtr), item(std::forward<Args>(args)...)
 {
 }
 // Replaces this Node's item with anItem
@@ -68,412 +143,799 @@ void Node<ItemType>::setItem(const ItemType& anItem)
 {
 	item = anItem;
 }
-// Replaces this Node's next with nextNodePtr
+// Moves anItem into this Node's item
 template<class ItemType>
-void Node<ItemType>::setNext(Node<ItemType>* nextNodePtr)
+void Node<ItemType>::setItem(ItemType&& anItem)
 {
-	next = nextNodePtr;
+	item = std::move(anItem);
 }
-// Assists List with access to item
+// Assists List with access to item, no copy is made
 template<class ItemType>
-ItemType Node<ItemType>::getItem() const
+inline const ItemType& Node<ItemType>::getItem() const
 {
 	return item;
 }
-// Assists List with access to next
 template<class ItemType>
-Node<ItemType>* Node<ItemType>::getNext() const
+inline ItemType& Node<ItemType>::getItem()
 {
-	return next;
+	return item;
+}
+// Forward iterator over a chain of Nodes
+// ValueType is ItemType for iterator, const ItemType for const_iterator
+// Holds nothing but a pointer, so any number of iterators can walk
+// the same list at once
+template<class ItemType, class ValueType>
+class ListIterator
+{
+private:
+	// Current Node, or a list's head for before_begin
+	NodeBase<ItemType>* curPtr;
+	template<class, class> friend class ListIterator;
+	template<class, class> friend class LinkedList;
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef ItemType value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef ValueType* pointer;
+	typedef ValueType& reference;
+	// Singular iterator
+	ListIterator();
+	// Points at nodePtr (nullptr is end)
+	explicit ListIterator(NodeBase<ItemType>* nodePtr);
+	// Copies an iterator, or converts iterator to const_iterator
+	ListIterator(const ListIterator<ItemType, ItemType>& anIter);
+	ListIterator<ItemType, ValueType>& operator=(const ListIterator<ItemType, ValueType>& anIter) = default;
+	// Current Node's item
+	reference operator*() const;
+	pointer operator->() const;
+	// Steps to the next Node
+	ListIterator<ItemType, ValueType>& operator++();
+	ListIterator<ItemType, ValueType> operator++(int);
+	// Iterators are equal when they point at the same Node
+	template<class OtherType>
+	bool operator==(const ListIterator<ItemType, OtherType>& rhs) const;
+	template<class OtherType>
+	bool operator!=(const ListIterator<ItemType, OtherType>& rhs) const;
+};
+template<class ItemType, class ValueType>
+inline ListIterator<ItemType, ValueType>::ListIterator() : curPtr(nullptr)
+{
+}
+template<class ItemType, class ValueType>
+inline ListIterator<ItemType, ValueType>::ListIterator(NodeBase<ItemType>* nodePtr) :
+	curPtr(nodePtr)
+{
+}
+template<class ItemType, class ValueType>
+inline ListIterator<ItemType, ValueType>::ListIterator(const ListIterator<ItemType, ItemType>& anIter) :
+	curPtr(anIter.curPtr)
+{
+}
+// Only a real Node may be dereferenced, never end or before_begin
+template<class ItemType, class ValueType>
+inline typename ListIterator<ItemType, ValueType>::reference
+	ListIterator<ItemType, ValueType>::operator*() const
+{
+	return static_cast<Node<ItemType>*>(curPtr)->item;
+}
+template<class ItemType, class ValueType>
+inline typename ListIterator<ItemType, ValueType>::pointer
+	ListIterator<ItemType, ValueType>::operator->() const
+{
+	return &static_cast<Node<ItemType>*>(curPtr)->item;
+}
+template<class ItemType, class ValueType>
+inline ListIterator<ItemType, ValueType>& ListIterator<ItemType, ValueType>::operator++()
+{
+	curPtr = curPtr->getNext();
+	return *this;
+}
+template<class ItemType, class ValueType>
+inline ListIterator<ItemType, ValueType> ListIterator<ItemType, ValueType>::operator++(int)
+{
+	ListIterator<ItemType, ValueType> prev(*this);
+	curPtr = curPtr->getNext();
+	return prev;
+}
+template<class ItemType, class ValueType>
+template<class OtherType>
+inline bool ListIterator<ItemType, ValueType>::operator==(const ListIterator<ItemType, OtherType>& rhs) const
+{
+	return curPtr == rhs.curPtr;
+}
+template<class ItemType, class ValueType>
+template<class OtherType>
+inline bool ListIterator<ItemType, ValueType>::operator!=(const ListIterator<ItemType, OtherType>& rhs) const
+{
+	return curPtr != rhs.curPtr;
 }
 // Linked List of Nodes
-template<class ItemType>
+// Non-const getEntry/setEntry move a cached cursor; const reads
+// write nothing, so threads may share one const list
+template<class ItemType, class Allocator = SlabAllocator<Node<ItemType> > >
 class LinkedList : public ListInterface<ItemType>
 {
 private:
-	// Points to nullptr/First Node
-	Node<ItemType>* headPtr;
+	// head.getNext() points to nullptr/First Node
+	NodeBase<ItemType> head;
+	// Points to nullptr/Last Node
+	Node<ItemType>* tailPtr;
 	// Count of Nodes
 	int itemCount;
-	// Prevents heap fragmentation
-	static Node<ItemType>* free;
-	// Iterator
-	Node<ItemType>* trav_p;
-	// Iterator flag
-	bool TraverseOK;
-	// Creates a new Node or pulls one from the free list
-	Node<ItemType>* getListEl(void);
+	// Last Node found by getNodeAt and its position
+	// Lets sequential getEntry/setEntry resume instead of restarting at head
+	// Reset whenever Nodes before or at cursorPos move
+	Node<ItemType>* cursorPtr;
+	int cursorPos;
+	// Forgets the cursor
+	void resetCursor(void);
+	// Constructs a new Node in storage from Allocator
+	// args, if any, build the Node's item
+	template<class... Args>
+	Node<ItemType>* getListEl(Args&&... args);
 	// Get/Set Entry helper function: returns ptr to Node
-	Node<ItemType>* getNodeAt(int position) const;
-	// Print in descending order
-	void printRevHelper(Node<ItemType>* curPtr) const;
-	// Links a removed Node to Free List for reuse
+	// Resumes from and moves the cursor
+	Node<ItemType>* getNodeAt(int position);
+	// Same for const reads, walks from head and leaves the cursor alone
+	Node<ItemType>* findNodeAt(int position) const;
+	// Print in descending order, separator between items
+	void printRev(ListWriter& out, const char* separator) const;
+	// Destroys a removed Node and returns it to Allocator
 	void freeListEl(Node<ItemType>* curPtr);
-	// Recursively make a substring
-	void substrHelper(Node<ItemType>* anEntry, LinkedList<ItemType>& aList, int len);
-	// Returns a ptr to thisList's headPtr
+	// Destroys a removed Node and links its storage in front of
+	// chain, returns the new front; freeChain returns the lot
+	Node<ItemType>* retireListEl(Node<ItemType>* curPtr, Node<ItemType>* chain);
+	// Returns count retired Nodes, first to last, in one batch
+	void freeChain(Node<ItemType>* first, Node<ItemType>* last, int count);
+	// Predicates for remove_all
+	struct EqualTo
+	{
+		const ItemType* value;
+		bool operator()(const ItemType& anItem) const { return anItem == *value; }
+	};
+	struct InKeys
+	{
+		const std::vector<ItemType>* keys;
+		bool operator()(const ItemType& anItem) const { return std::binary_search(keys->begin(), keys->end(), anItem); }
+	};
+	// Repeats one item forever, feeds linkRange for resize
+	struct FillIterator
+	{
+		const ItemType* value;
+		const ItemType& operator*() const { return *value; }
+		FillIterator& operator++() { return *this; }
+	};
+	// Builds count Nodes from first, first + 1, ... in storage taken
+	// from Allocator in one burst and links them after prevPtr
+	// If an item throws, thisList is left as it was
+	template<class ForwardIt>
+	void linkRange(NodeBase<ItemType>* prevPtr, ForwardIt first, int count);
+	// Links copies of [first, last) after prevPtr, returns how many
+	// Forward ranges are counted and built by linkRange
+	// Single pass ranges are built one Node at a time
+	template<class InputIt>
+	int insertAfter(NodeBase<ItemType>* prevPtr, InputIt first, InputIt last, std::input_iterator_tag);
+	template<class ForwardIt>
+	int insertAfter(NodeBase<ItemType>* prevPtr, ForwardIt first, ForwardIt last, std::forward_iterator_tag);
+	// Returns a ptr to thisList's first Node
 	Node<ItemType>* getHeadPtr(void);
-	// Modify ptr to a specific list
-	void setHeadPtr(Node<ItemType>* newList);
-	// Allows reverse to perform recursively
-	Node<ItemType>* reverseHelper(Node<ItemType>* anEntry);
-	// Appends rhs to lhs
-	void appendHelper(Node<ItemType> *lhs, Node<ItemType> *rhs);
+	// Cuts the chain starting at curPtr after len Nodes
+	// Returns the rest of the chain, nullptr if nothing is left
+	static Node<ItemType>* splitAfter(Node<ItemType>* curPtr, int len);
+	// Links two sorted chains after tail in order, returns the last Node
+	template<class Compare>
+	static NodeBase<ItemType>* mergeChains(Node<ItemType>* lhs, Node<ItemType>* rhs, NodeBase<ItemType>* tail, Compare& comp);
+	// One list's unmerged Nodes in merge_all's heap
+	// source breaks ties, so equal items keep their lists' order
+	struct MergeSource
+	{
+		Node<ItemType>* front;
+		Node<ItemType>* back;
+		int source;
+	};
+	// Checks if lhs's front goes before rhs's front
+	template<class Compare>
+	static bool sourceBefore(const MergeSource& lhs, const MergeSource& rhs, Compare& comp);
+	// Moves heap[index] down until neither child goes before it
+	template<class Compare>
+	static void siftDown(std::vector<MergeSource>& heap, int index, Compare& comp);
 public:
+	// Type of the items, as in the standard containers
+	typedef ItemType value_type;
+	// Policy Nodes are allocated with
+	typedef Allocator allocator_type;
+	// Forward iterators over the items
+	typedef ListIterator<ItemType, ItemType> iterator;
+	typedef ListIterator<ItemType, const ItemType> const_iterator;
 	// Default constructor
 	LinkedList();
 	// List Copy Constructor
-	LinkedList(const LinkedList<ItemType>& aList);
+	LinkedList(const LinkedList<ItemType, Allocator>& aList);
+	// Copies the items of [first, last) in order
+	template<class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+	LinkedList(InputIt first, InputIt last);
+	// Copies the items of anInitList in order
+	LinkedList(std::initializer_list<ItemType> anInitList);
+	// List Move Constructor, takes over aList's Nodes
+	LinkedList(LinkedList<ItemType, Allocator>&& aList) noexcept;
 	// Assignment operator copies aList into thisList
-	LinkedList<ItemType>& operator=(const LinkedList<ItemType>& aList);
+	LinkedList<ItemType, Allocator>& operator=(const LinkedList<ItemType, Allocator>& aList);
+	// Move assignment, takes over aList's Nodes
+	LinkedList<ItemType, Allocator>& operator=(LinkedList<ItemType, Allocator>&& aList) noexcept;
 	// Destructor
 	virtual ~LinkedList();
 	// Modify a specified Node's item
 	void setEntry(int position, const ItemType& newEntry);
+	void setEntry(int position, ItemType&& newEntry);
 	// Increase or decrease itemCount manually
 	void setLength(int n);
 	// Get a specified Node's item
-	ItemType getEntry(int position) const;
+	const ItemType& getEntry(int position) const;
+	ItemType& getEntry(int position);
+	// First and last items, O(1)
+	ItemType& front(void);
+	const ItemType& front(void) const;
+	ItemType& back(void);
+	const ItemType& back(void) const;
 	// Get number of Nodes in List
 	int getLength() const;
 	// Sequential search for item
 	bool isInList(const ItemType& anEntry);
-	// Iterates first or next Node
-	Node<ItemType>* traverse(bool first);
 	// Inserts a Node into the specified position of thisList
 	void insert(int position, const ItemType& newEntry);
+	void insert(int position, ItemType&& newEntry);
+	// Builds a Node's item in place from args at the specified position
+	template<class... Args>
+	void emplace(int position, Args&&... args);
 	// Inserts a Node in ascending order
 	void insertSorted(const ItemType& newEntry);
 	// Inserts Node at the beginning of List
 	void push(const ItemType& newEntry);
-	// Removes a Node and returns to Free List
+	void push(ItemType&& newEntry);
+	// Builds a Node's item in place from args at the beginning of List
+	template<class... Args>
+	void emplace_front(Args&&... args);
+	// Inserts Node at the end of List in O(1)
+	void push_back(const ItemType& newEntry);
+	void push_back(ItemType&& newEntry);
+	// Builds a Node's item in place from args at the end of List
+	template<class... Args>
+	void emplace_back(Args&&... args);
+	// Removes a Node and returns it to Allocator
 	bool remove(const ItemType & newEntry);
-	// Removes first Node and returns to Free List
+	// Removes first Node and returns it to Allocator
 	bool pop();
+	// Remove every item pred is true for, every item equal to value,
+	// or every item equal to one of [first, last), in one pass
+	// Removed Nodes go back to Allocator in one batch
+	// Return how many were removed
+	template<class Predicate>
+	int remove_if(Predicate pred);
+	int remove_all(const ItemType& value);
+	template<class InputIt>
+	int remove_all(InputIt first, InputIt last);
+	// Removes every item equal to the one before it, so a sorted
+	// List keeps one of each; returns how many were removed
+	int unique(void);
 	// Checks if itemCount is 0
 	bool isEmpty() const;
 	// Increase/decrease the number of Nodes in thisList
+	// New Nodes are copies of value
 	void resize(int len, const ItemType& value);
+	// Replaces thisList's items with copies of [first, last)
+	// Existing Nodes are reused, only the shortfall is allocated
+	template<class InputIt>
+	void assign(InputIt first, InputIt last);
+	void assign(std::initializer_list<ItemType> anInitList);
+	// Inserts copies of [first, last) starting at position
+	template<class InputIt>
+	void insert_range(int position, InputIt first, InputIt last);
 	// Removes all Nodes in the List
 	void clear(void);
 	// Displays all Node's item to stdout
 	void printList(int direction) const;
+	// Writes all items to os or out, separator between items,
+	// front to back if direction is Forward else back to front
+	void printList(std::ostream& os, int direction, const char* separator = "") const;
+	void printList(ListWriter& out, int direction, const char* separator = "") const;
 	// printList's direction variables
 	static int Forward;
 	static int Reverse;
 	// Returns a newly constructed string object with its
 	// value initialized to a copy of a substring of this object.
-	LinkedList<ItemType> &subStr(int position, int len);
-	// Appends aList to the end of thisList
-	LinkedList<ItemType> &append(LinkedList<ItemType>& aList);
+	// ListView (ListView.h) slices without copying
+	LinkedList<ItemType, Allocator> subStr(int position, int len) const;
+	// Moves aList's Nodes to the end of thisList in O(1)
+	LinkedList<ItemType, Allocator> &append(LinkedList<ItemType, Allocator>& aList);
+	// Moves aList's Nodes in after position in O(1), aList is left empty
+	void splice_after(const_iterator position, LinkedList<ItemType, Allocator>& aList);
 	// Reverses in place
-	LinkedList<ItemType> &reverse(void);
+	LinkedList<ItemType, Allocator> &reverse(void);
+	// Stable bottom-up merge sort, relinks Nodes in place
+	// Ascending by operator<, or by comp(a, b) meaning a goes before b
+	void sort(void);
+	template<class Compare>
+	void sort(Compare comp);
+	// Moves sorted aList's Nodes into sorted thisList, keeping the order
+	// No Node is allocated, aList is left empty
+	void merge(LinkedList<ItemType, Allocator>& aList);
+	template<class Compare>
+	void merge(LinkedList<ItemType, Allocator>& aList, Compare comp);
+	// Moves the Nodes of count sorted lists into sorted thisList in
+	// O(n log k), k being the number of lists; lists are left empty
+	// No Node is allocated, the heap holds one entry per list
+	// With dedupe, an item equal to the one before it is freed, and
+	// the freed Nodes go back to Allocator in one batch
+	void merge_all(LinkedList<ItemType, Allocator>* const* lists, int count, bool dedupe = false);
+	template<class Compare>
+	void merge_all(LinkedList<ItemType, Allocator>* const* lists, int count, Compare comp, bool dedupe = false);
+	// Moves the items so list order is address order, and long walks
+	// read memory front to back instead of jumping around
+	void compact(void);
 	// Empties a list's contents
 	void deleteList(void);
+	// Iterator to the first item
+	iterator begin(void);
+	const_iterator begin(void) const;
+	const_iterator cbegin(void) const;
+	// Iterator past the last item
+	iterator end(void);
+	const_iterator end(void) const;
+	const_iterator cend(void) const;
+	// Iterator before the first item, for use with the *_after functions
+	iterator before_begin(void);
+	const_iterator before_begin(void) const;
+	const_iterator cbefore_begin(void) const;
 };
-// Initialize Free List
-template<class ItemType>
-Node<ItemType>* LinkedList<ItemType>::free = nullptr;
-// If Free List has a Node set curPtr to that Node
-// and unlink it from the Free List
-// Else create a new Node
-// Zero out Node's variables and return
-template<class ItemType>
-Node<ItemType>* LinkedList<ItemType>::getListEl(void)
+// Get storage from Allocator (recycled or carved from a slab)
+// Construct an unlinked Node in it from args (zeroed out if none)
+// If the item throws, give the storage back and rethrow,
+// as a plain new Node would
+template<class ItemType, class Allocator>
+template<class... Args>
+inline Node<ItemType>* LinkedList<ItemType, Allocator>::getListEl(Args&&... args)
 {
-	Node<ItemType>* curPtr;
-	if (free != nullptr)
+	Node<ItemType>* nextPtr = nullptr;
+	Node<ItemType>* storage = Allocator::allocate();
+	try
 	{
-		curPtr = free;
-		free = free->getNext();
+		new (storage) Node<ItemType>(nextPtr, std::forward<Args>(args)...);
 	}
-	else
-		curPtr = new Node<ItemType>;
-	curPtr->setItem(NULL);
-	curPtr->setNext(nullptr);
-	return curPtr;
+	catch (...)
+	{
+		Allocator::deallocate(storage);
+		throw;
+	}
+	ListStats::allocated(1);
+	return storage;
 }
 // Up to the user to enter a legal position
-// Set curPtr to head of List
-// Skip down the List to the specified position
-// return a ptr to the specified Node
-template<class ItemType>
-Node<ItemType>* LinkedList<ItemType>::getNodeAt(int position) const
+// First and last Nodes are O(1)
+// If the cursor is at or before position, set curPtr to it
+// Else set curPtr to head of List
+// Skip down the List to the specified position, counting the steps
+// Remember it in the cursor and return a ptr to the specified Node
+template<class ItemType, class Allocator>
+Node<ItemType>* LinkedList<ItemType, Allocator>::getNodeAt(int position)
 {
 	assert((position >= 1) && (position <= itemCount));
-	if (position == 1) return headPtr;
-	Node<ItemType>* curPtr = headPtr;
-	for (int skip = 1; skip < position; skip++, curPtr = curPtr->getNext());
+	if (position == 1 || position == itemCount)
+	{
+		ListStats::walked(0);
+		return position == 1 ? head.getNext() : tailPtr;
+	}
+	Node<ItemType>* curPtr = head.getNext();
+	int skip = 1;
+	if (cursorPtr != nullptr && cursorPos <= position)
+	{
+		curPtr = cursorPtr;
+		skip = cursorPos;
+	}
+	ListStats::walked(position - skip);
+	for (; skip < position; skip++, curPtr = curPtr->getNext());
+	cursorPtr = curPtr;
+	cursorPos = position;
 	return curPtr;
 }
-// Print all Node items in descending order by way of recursion
-template<class ItemType>
-void LinkedList<ItemType>::printRevHelper(Node<ItemType>* curPtr) const
+// Up to the user to enter a legal position
+// First and last Nodes are O(1)
+// Else skip down from head; nothing is written, so any number of
+// threads may look up a shared const List at once
+template<class ItemType, class Allocator>
+Node<ItemType>* LinkedList<ItemType, Allocator>::findNodeAt(int position) const
 {
-	if (curPtr != NULL)
+	assert((position >= 1) && (position <= itemCount));
+	if (position == itemCount)
 	{
-		printRevHelper(curPtr->getNext());
-		std::cout << curPtr->getItem() << " ";
+		ListStats::walked(0);
+		return tailPtr;
 	}
+	Node<ItemType>* curPtr = head.getNext();
+	ListStats::walked(position - 1);
+	for (int skip = 1; skip < position; skip++, curPtr = curPtr->getNext());
+	return curPtr;
 }
-// Link a removed Node to the Free List
-template<class ItemType>
-void LinkedList<ItemType>::freeListEl(Node<ItemType>* curPtr)
+// Next getNodeAt starts over from head
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::resetCursor(void)
 {
-	curPtr->setItem(NULL);
-	curPtr->setNext(free);
-	free = curPtr;
+	cursorPtr = nullptr;
+	cursorPos = 0;
 }
-// Allows subStr to perform recursively.
-// Folds to end of anEntry's List
-template<class ItemType>
-void LinkedList<ItemType>::substrHelper(Node<ItemType>* anEntry, LinkedList<ItemType>& aList, int len)
+// Print all Node items in descending order without recursion
+// Walk thisList once, keeping every blockLen-th Node as a checkpoint
+// (blockLen is about the square root of itemCount)
+// From the last checkpoint back to the first, collect that
+// block's Nodes and print them back to front
+// Every Node is visited twice and only about 2 * sqrt(n) ptrs are kept
+// Items go through out's buffer, not one stream call each
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::printRev(ListWriter& out, const char* separator) const
 {
-	if (len != 0)
+	int blockLen = 1;
+	while (blockLen * blockLen < itemCount)
+		++blockLen;
+	std::vector<const Node<ItemType>*> checkpoints, block;
+	checkpoints.reserve(itemCount / blockLen + 1);
+	block.reserve(blockLen);
+	int count = 0, printed = 0;
+	for (const Node<ItemType>* curPtr = head.getNext(); curPtr != nullptr; curPtr = curPtr->getNext())
+		if (count++ % blockLen == 0)
+			checkpoints.push_back(curPtr);
+	for (int i = int(checkpoints.size()) - 1; i >= 0; --i)
 	{
-		substrHelper(anEntry->getNext(), aList, (len - 1));
-		aList.push(anEntry->getItem());
+		block.clear();
+		const Node<ItemType>* curPtr = checkpoints[i];
+		for (int j = 0; j < blockLen && curPtr != nullptr; ++j, curPtr = curPtr->getNext())
+			block.push_back(curPtr);
+		for (int j = int(block.size()) - 1; j >= 0; --j)
+		{
+			if (++printed > 1) out << separator;
+			out << block[j]->getItem();
+		}
 	}
 }
-// Used with printList function
-template<class ItemType>
-int LinkedList<ItemType>::Forward = 1;
-template<class ItemType>
-int LinkedList<ItemType>::Reverse = -1;
-// Initiate the Linked List's headPtr and itemCount
-template<class ItemType>
-LinkedList<ItemType>::LinkedList() : headPtr(nullptr), itemCount(0)
+// Destroy a removed Node and hand its storage back to Allocator
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::freeListEl(Node<ItemType>* curPtr)
 {
+	curPtr->~Node<ItemType>();
+	Allocator::deallocate(curPtr);
+	ListStats::freed(1);
 }
-// Prevent from self assignment
-// If the thisList has Nodes, clear them
-// Iterate to end of aList, inserting Nodes into thisList based on aList's Nodes
-template<class ItemType>
-LinkedList<ItemType>::LinkedList(const LinkedList<ItemType>& aList)
+// Destroy the Node and reuse its storage as a chain link
+template<class ItemType, class Allocator>
+inline Node<ItemType>* LinkedList<ItemType, Allocator>::retireListEl(Node<ItemType>* curPtr, Node<ItemType>* chain)
 {
-	assert(this != &aList);
-	TraverseOK = false;
-	deleteList();
-	Node<ItemType> *lhs = nullptr;
-	Node<ItemType> *rhs = aList.headPtr;
-	while (rhs != nullptr)
+	curPtr->~Node<ItemType>();
+	Allocator::setChainNext(curPtr, chain);
+	return curPtr;
+}
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::freeChain(Node<ItemType>* first, Node<ItemType>* last, int count)
+{
+	if (count == 0) return;
+	Allocator::deallocateChain(first, last, count);
+	ListStats::freed(count);
+}
+// Get a chain of count raw Nodes from Allocator
+// Step down it, building each Node from *first and linking it
+// after the last one, reading the chain's next before building
+// Nothing is linked into thisList until every Node is built:
+// if an item throws, destroy the built Nodes, give them back with
+// the unbuilt rest of the chain in one batch, and rethrow
+// Else link the run after prevPtr and the old next after it
+// If prevPtr was the last Node (or head of an empty List),
+// the last new Node is the tail
+template<class ItemType, class Allocator>
+template<class ForwardIt>
+void LinkedList<ItemType, Allocator>::linkRange(NodeBase<ItemType>* prevPtr, ForwardIt first, int count)
+{
+	if (count == 0) return;
+	Node<ItemType> *rawPtr = Allocator::allocateChain(count), *storage = nullptr;
+	Node<ItemType> *frontPtr = nullptr, *lastPtr = nullptr, *nullPtr = nullptr;
+	int built = 0;
+	try
 	{
-		if (lhs == nullptr)
-		{
-			push(rhs->getItem());
-			lhs = headPtr;
-		}
-		else
+		for (; built < count; ++first)
 		{
-			Node<ItemType> *newNode = getListEl();
-			newNode->setItem(rhs->getItem());
-			newNode->setNext(nullptr);
-			lhs->setNext(newNode);
-			lhs = lhs->getNext();
-			++itemCount;
+			storage = rawPtr;
+			rawPtr = Allocator::chainNext(rawPtr);
+			Node<ItemType>* newNode = new (storage) Node<ItemType>(nullPtr, *first);
+			storage = nullptr;
+			if (lastPtr == nullptr)
+				frontPtr = newNode;
+			else
+				lastPtr->setNext(newNode);
+			lastPtr = newNode;
+			++built;
 		}
-		rhs = rhs->getNext();
 	}
-}
-// Clears thisList
-// Copies all aList items into thisList
-template<class ItemType>
-inline LinkedList<ItemType>& LinkedList<ItemType>::operator=(const LinkedList<ItemType>& aList)
-{
-	assert(this != &aList);
-	TraverseOK = false;
-	deleteList();
-	Node<ItemType> *lhs = nullptr;
-	Node<ItemType> *rhs = aList.headPtr;
-	while (rhs != nullptr)
+	catch (...)
 	{
-		if (lhs == nullptr)
+		if (storage != nullptr)
 		{
-			push(rhs->getItem());
-			lhs = headPtr;
+			Allocator::setChainNext(storage, rawPtr);
+			rawPtr = storage;
 		}
-		else
+		Node<ItemType>* chainLast = frontPtr;
+		if (built < count)
 		{
-			Node<ItemType> *newNode = getListEl();
-			newNode->setItem(rhs->getItem());
-			newNode->setNext(nullptr);
-			lhs->setNext(newNode);
-			lhs = lhs->getNext();
-			++itemCount;
+			chainLast = rawPtr;
+			for (int i = built + 1; i < count; ++i)
+				chainLast = Allocator::chainNext(chainLast);
+		}
+		for (Node<ItemType>* curPtr = frontPtr; built > 0; --built)
+		{
+			Node<ItemType>* nextPtr = curPtr->getNext();
+			rawPtr = retireListEl(curPtr, rawPtr);
+			curPtr = nextPtr;
 		}
-		rhs = rhs->getNext();
+		Allocator::deallocateChain(rawPtr, chainLast, count);
+		throw;
 	}
-	return *this;
+	Node<ItemType>* nextPtr = prevPtr->getNext();
+	lastPtr->setNext(nextPtr);
+	prevPtr->setNext(frontPtr);
+	if (nextPtr == nullptr)
+		tailPtr = lastPtr;
+	itemCount += count;
+	ListStats::allocated(count);
 }
-// Destructor just uses clear
-template<class ItemType>
-LinkedList<ItemType>::~LinkedList()
+// Build the items into a List of their own one at a time,
+// then splice it in after prevPtr
+template<class ItemType, class Allocator>
+template<class InputIt>
+int LinkedList<ItemType, Allocator>::insertAfter(NodeBase<ItemType>* prevPtr, InputIt first, InputIt last, std::input_iterator_tag)
 {
-	clear();
+	LinkedList<ItemType, Allocator> newList;
+	for (; first != last; ++first)
+		newList.emplace_back(*first);
+	int count = newList.itemCount;
+	splice_after(const_iterator(prevPtr), newList);
+	return count;
 }
-// Used to point thisList elsewhere
-template<class ItemType>
-void LinkedList<ItemType>::setHeadPtr(Node<ItemType>* newList)
+// Count the items, then build them all in one burst
+template<class ItemType, class Allocator>
+template<class ForwardIt>
+int LinkedList<ItemType, Allocator>::insertAfter(NodeBase<ItemType>* prevPtr, ForwardIt first, ForwardIt last, std::forward_iterator_tag)
 {
-	headPtr = newList;
+	int count = int(std::distance(first, last));
+	linkRange(prevPtr, first, count);
+	return count;
 }
-template<class ItemType>
-Node<ItemType>* LinkedList<ItemType>::reverseHelper(Node<ItemType>* anEntry)
+// Used with printList function
+template<class ItemType, class Allocator>
+int LinkedList<ItemType, Allocator>::Forward = 1;
+template<class ItemType, class Allocator>
+int LinkedList<ItemType, Allocator>::Reverse = -1;
+// Initiate the Linked List's head and itemCount
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator>::LinkedList() :
+	head(nullptr), tailPtr(nullptr), itemCount(0), cursorPtr(nullptr), cursorPos(0)
 {
-	if (anEntry != nullptr)
-	{
-		Node<ItemType>* ptr = reverseHelper(anEntry->getNext());
-		if (ptr == nullptr)
-		{
-			headPtr = anEntry;
-			return anEntry;
-		}
-		else
-		{
-			anEntry->setNext(nullptr);
-			ptr->setNext(anEntry);
-			return anEntry;
-		}
-	}
-	return nullptr;
 }
-template<class ItemType>
-void LinkedList<ItemType>::appendHelper(Node<ItemType>* lhs, Node<ItemType>* rhs)
+// Start out empty
+// Link copies of aList's items in one pass
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator>::LinkedList(const LinkedList<ItemType, Allocator>& aList) :
+	head(nullptr), tailPtr(nullptr), itemCount(0), cursorPtr(nullptr), cursorPos(0)
 {
-	TraverseOK = false;
-	if (lhs == nullptr)
-		lhs = rhs;
-	else
-	{
-		Node<ItemType> *curPtr = rhs;
-		while (curPtr->getNext() != nullptr)
-			curPtr = curPtr->getNext();
-		curPtr->setNext(rhs);
-	}
-	rhs = nullptr;
+	linkRange(&head, aList.begin(), aList.itemCount);
+	ListStats::copied(aList.itemCount);
+}
+// Start out empty
+// Link copies of [first, last) in one pass
+template<class ItemType, class Allocator>
+template<class InputIt, class>
+LinkedList<ItemType, Allocator>::LinkedList(InputIt first, InputIt last) :
+	head(nullptr), tailPtr(nullptr), itemCount(0), cursorPtr(nullptr), cursorPos(0)
+{
+	insertAfter(&head, first, last, typename std::iterator_traits<InputIt>::iterator_category());
+}
+// Start out empty
+// Link copies of anInitList's items in one pass
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator>::LinkedList(std::initializer_list<ItemType> anInitList) :
+	head(nullptr), tailPtr(nullptr), itemCount(0), cursorPtr(nullptr), cursorPos(0)
+{
+	linkRange(&head, anInitList.begin(), int(anInitList.size()));
+}
+// Prevent from self assignment
+// Copies all aList items into thisList's Nodes through assign
+template<class ItemType, class Allocator>
+inline LinkedList<ItemType, Allocator>& LinkedList<ItemType, Allocator>::operator=(const LinkedList<ItemType, Allocator>& aList)
+{
+	assert(this != &aList);
+	assign(aList.begin(), aList.end());
+	ListStats::copied(aList.itemCount);
+	return *this;
+}
+// Takes aList's head, tail and count
+// Leaves aList empty
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator>::LinkedList(LinkedList<ItemType, Allocator>&& aList) noexcept :
+	head(aList.head.getNext()), tailPtr(aList.tailPtr), itemCount(aList.itemCount),
+	cursorPtr(nullptr), cursorPos(0)
+{
+	aList.head.setNext(nullptr);
+	aList.tailPtr = nullptr;
+	aList.itemCount = 0;
+	aList.resetCursor();
+}
+// Clears thisList
+// Takes aList's head, tail and count
+// Leaves aList empty
+template<class ItemType, class Allocator>
+inline LinkedList<ItemType, Allocator>& LinkedList<ItemType, Allocator>::operator=(LinkedList<ItemType, Allocator>&& aList) noexcept
+{
+	if (this == &aList) return *this;
+	clear();
+	head.setNext(aList.head.getNext());
+	tailPtr = aList.tailPtr;
+	itemCount = aList.itemCount;
+	aList.head.setNext(nullptr);
+	aList.tailPtr = nullptr;
+	aList.itemCount = 0;
+	aList.resetCursor();
+	return *this;
+}
+// Destructor just uses clear
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator>::~LinkedList()
+{
+	clear();
 }
 // Up to the user to enter a legal position
 // Modifies specified Node's item
-template<class ItemType>
-void LinkedList<ItemType>::setEntry(int position, const ItemType & newEntry)
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::setEntry(int position, const ItemType & newEntry)
 {
 	assert((position >= 1) && (position <= itemCount));
 	Node<ItemType>* nodePtr = getNodeAt(position);
 	nodePtr->setItem(newEntry);
 }
+// Up to the user to enter a legal position
+// Moves newEntry into specified Node's item
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::setEntry(int position, ItemType && newEntry)
+{
+	assert((position >= 1) && (position <= itemCount));
+	Node<ItemType>* nodePtr = getNodeAt(position);
+	nodePtr->setItem(std::move(newEntry));
+}
 // Increase/Decrease itemCount
-template<class ItemType>
-void LinkedList<ItemType>::setLength(int n)
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::setLength(int n)
 {
 	assert(n >= 0);
 	itemCount = n;
+	resetCursor();
 }
 // Up to the user to enter a legal position
-// Returns the specified Node's item
-template<class ItemType>
-ItemType LinkedList<ItemType>::getEntry(int position) const
+// Returns the specified Node's item by reference
+// The const overload walks from head without touching the cursor,
+// the other resumes from it
+template<class ItemType, class Allocator>
+const ItemType& LinkedList<ItemType, Allocator>::getEntry(int position) const
+{
+	assert((position >= 1) && (position <= itemCount));
+	Node<ItemType>* nodePtr = findNodeAt(position);
+	return nodePtr->getItem();
+}
+template<class ItemType, class Allocator>
+ItemType& LinkedList<ItemType, Allocator>::getEntry(int position)
 {
 	assert((position >= 1) && (position <= itemCount));
 	Node<ItemType>* nodePtr = getNodeAt(position);
 	return nodePtr->getItem();
 }
+// Up to the user to check the List isn't empty
+// Returns the first Node's item
+template<class ItemType, class Allocator>
+inline ItemType& LinkedList<ItemType, Allocator>::front(void)
+{
+	assert(itemCount > 0);
+	return head.getNext()->getItem();
+}
+template<class ItemType, class Allocator>
+inline const ItemType& LinkedList<ItemType, Allocator>::front(void) const
+{
+	assert(itemCount > 0);
+	return head.getNext()->getItem();
+}
+// Up to the user to check the List isn't empty
+// Returns the last Node's item
+template<class ItemType, class Allocator>
+inline ItemType& LinkedList<ItemType, Allocator>::back(void)
+{
+	assert(itemCount > 0);
+	return tailPtr->getItem();
+}
+template<class ItemType, class Allocator>
+inline const ItemType& LinkedList<ItemType, Allocator>::back(void) const
+{
+	assert(itemCount > 0);
+	return tailPtr->getItem();
+}
 // Returns count of Nodes
-template<class ItemType>
-int LinkedList<ItemType>::getLength() const
+template<class ItemType, class Allocator>
+int LinkedList<ItemType, Allocator>::getLength() const
 {
 	return itemCount;
 }
-template<class ItemType>
-Node<ItemType>* LinkedList<ItemType>::getHeadPtr(void)
+template<class ItemType, class Allocator>
+Node<ItemType>* LinkedList<ItemType, Allocator>::getHeadPtr(void)
 {
-	return headPtr;
+	return head.getNext();
 }
 // Sequentially search for anEntry in thisList
 // True if found else false
-template<class ItemType>
-bool LinkedList<ItemType>::isInList(const ItemType & anEntry)
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::isInList(const ItemType & anEntry)
 {
-	Node<ItemType>* curPtr = headPtr;
+	Node<ItemType>* curPtr = head.getNext();
 	while (curPtr != nullptr && curPtr->getItem() < anEntry)
 		curPtr = curPtr->getNext();
 	return curPtr != nullptr && curPtr->getItem() == anEntry;
 }
-// If first is true, point travPtr to head (could be nullptr)
-// If traverse flag is false, do not iterate (return nullptr)
-// Else point travPtr to next Node
-// If travPtr != nullPtr return travPtr
-// Else return nullptr
-template<class ItemType>
-Node<ItemType>* LinkedList<ItemType>::traverse(bool first)
+// Copies newEntry into a new Node at position
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::insert(int position, const ItemType & newEntry)
 {
-	if (first)
-	{
-		trav_p = headPtr;
-		TraverseOK = true;
-	}
-	else if (TraverseOK == false)
-	{
-		return nullptr;
-	}
-	else if (trav_p != nullptr)
-	{
-		trav_p = trav_p->getNext();
-	}
-	if (trav_p != nullptr)
-	{
-		return trav_p;
-	}
-	return nullptr;
+	emplace(position, newEntry);
 }
-// Inchworm down the List
-// Initialized and inserts new Node
-template<class ItemType>
-inline void LinkedList<ItemType>::insert(int position, const ItemType & newEntry)
+// Moves newEntry into a new Node at position
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::insert(int position, ItemType && newEntry)
+{
+	emplace(position, std::move(newEntry));
+}
+// Front and back are O(1) through emplace_front and emplace_back
+// Else inchworm down the List
+// Build and link in new Node after position - 1
+// A cursor past position - 1 now sits one position further down
+template<class ItemType, class Allocator>
+template<class... Args>
+void LinkedList<ItemType, Allocator>::emplace(int position, Args&&... args)
 {
 	assert((position >= 1) && (position <= itemCount + 1));
-	if (position == 1) push(newEntry);
+	if (position == 1) emplace_front(std::forward<Args>(args)...);
+	else if (position == itemCount + 1) emplace_back(std::forward<Args>(args)...);
 	else
 	{
 		Node<ItemType> *curPtr = getNodeAt(position - 1);
-		Node<ItemType> *newNode = getListEl();
-		newNode->setItem(newEntry);
-		newNode->setNext(nullptr);
-		TraverseOK = false;
-		if (curPtr->getNext() == nullptr)
-			curPtr->setNext(newNode);
-		else
-		{
-			newNode->setNext(curPtr->getNext()->getNext());
-			curPtr->setNext(newNode);
-		}
+		Node<ItemType> *newNode = getListEl(std::forward<Args>(args)...);
+		newNode->setNext(curPtr->getNext());
+		curPtr->setNext(newNode);
 		++itemCount;
+		if (cursorPos >= position) ++cursorPos;
 	}
 }
-// Gets a Node from Free List
-// Halt traversal
+// Gets a Node from Allocator
 // Initialize new Node's item to newEntry
 // Inchworm down the Linked List looking for insertion point
 // Ascending: curPtr->getItem() < newNode->getItem()
 // /*Descending: curPtr->getItem() > newNode->getItem()*/
 // If prevPtr is nullptr, Linked List is empty. Insert at head
 // Else insert between two Nodes or at end f Linked List
-template<class ItemType>
-void LinkedList<ItemType>::insertSorted(const ItemType& newEntry)
+// Entries arriving in order go straight to the tail
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::insertSorted(const ItemType& newEntry)
 {
-	if (headPtr == nullptr) push(newEntry);
+	if (head.getNext() == nullptr) push(newEntry);
+	else if (tailPtr->getItem() < newEntry) push_back(newEntry);
 	else
 	{
-		Node<ItemType> *newNode = getListEl();
+		Node<ItemType> *newNode = getListEl(newEntry);
 		Node<ItemType> *curPtr, *prevPtr;
-		TraverseOK = false;
-		newNode->setItem(newEntry);
-		for (curPtr = headPtr, prevPtr = nullptr;
+		for (curPtr = head.getNext(), prevPtr = nullptr;
 			curPtr != nullptr && curPtr->getItem() < newNode->getItem();
 			prevPtr = curPtr, curPtr = curPtr->getNext());
 		if (prevPtr == nullptr)
 		{
-			newNode->setNext(headPtr);
-			headPtr = newNode;
+			newNode->setNext(head.getNext());
+			head.setNext(newNode);
 		}
 		else
 		{
@@ -481,30 +943,70 @@ void LinkedList<ItemType>::insertSorted(const ItemType& newEntry)
 			prevPtr->setNext(newNode);
 		}
 		++itemCount;
+		resetCursor();
 	}
 }
-// Inserts a Node at the head of thisList
-template<class ItemType>
-inline void LinkedList<ItemType>::push(const ItemType & newEntry)
+// Inserts a copy of newEntry at the head of thisList
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::push(const ItemType & newEntry)
+{
+	emplace_front(newEntry);
+}
+// Moves newEntry into a Node at the head of thisList
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::push(ItemType && newEntry)
+{
+	emplace_front(std::move(newEntry));
+}
+// Builds a Node's item from args and links it at the head of thisList
+template<class ItemType, class Allocator>
+template<class... Args>
+inline void LinkedList<ItemType, Allocator>::emplace_front(Args&&... args)
 {
-	Node<ItemType>* newNode = getListEl();
-	TraverseOK = false;
-	newNode->setItem(newEntry);
-	newNode->setNext(headPtr);
-	headPtr = newNode;
+	Node<ItemType>* newNode = getListEl(std::forward<Args>(args)...);
+	newNode->setNext(head.getNext());
+	head.setNext(newNode);
+	if (tailPtr == nullptr) tailPtr = newNode;
+	++itemCount;
+	resetCursor();
+}
+// Links a copy of newEntry after tailPtr, or at head if thisList is empty
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::push_back(const ItemType & newEntry)
+{
+	emplace_back(newEntry);
+}
+// Moves newEntry into a Node after tailPtr
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::push_back(ItemType && newEntry)
+{
+	emplace_back(std::move(newEntry));
+}
+// Same as push_back, but item is built in place
+template<class ItemType, class Allocator>
+template<class... Args>
+inline void LinkedList<ItemType, Allocator>::emplace_back(Args&&... args)
+{
+	Node<ItemType>* newNode = getListEl(std::forward<Args>(args)...);
+	if (tailPtr == nullptr)
+		head.setNext(newNode);
+	else
+		tailPtr->setNext(newNode);
+	tailPtr = newNode;
 	++itemCount;
 }
 // Inchworm down Linked List
 // If curPtr == nullptr, item not found
 // If prevPtr == nullptr, Unlink first Node
 // Else unlink Node in the middle or end of Linked List
+// If the last Node was unlinked, prevPtr is the new tail
 // Reduce item Count
-// Return Node to Free List
-// Halt Traversal
-template<class ItemType>
-bool LinkedList<ItemType>::remove(const ItemType& newEntry)
+// Return Node to Allocator
+// Positions after curPtr shifted, so forget the cursor
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::remove(const ItemType& newEntry)
 {
-	Node<ItemType>* curPtr = headPtr, *prevPtr = nullptr;
+	Node<ItemType>* curPtr = head.getNext(), *prevPtr = nullptr;
 	while (curPtr != nullptr && curPtr->getItem() != newEntry)
 	{
 		prevPtr = curPtr;
@@ -513,191 +1015,607 @@ bool LinkedList<ItemType>::remove(const ItemType& newEntry)
 	if (curPtr == nullptr)
 		return false;
 	else if (prevPtr == nullptr)
-		headPtr = headPtr->getNext();
+		head.setNext(head.getNext()->getNext());
 	else
 		prevPtr->setNext(curPtr->getNext());
+	if (curPtr == tailPtr)
+		tailPtr = prevPtr;
 	--itemCount;
 	freeListEl(curPtr);
-	TraverseOK = false;
+	resetCursor();
 	return true;
 }
 // Removes the first Node in thisList
-template<class ItemType>
-inline bool LinkedList<ItemType>::pop()
+template<class ItemType, class Allocator>
+inline bool LinkedList<ItemType, Allocator>::pop()
 {
-	if (headPtr == nullptr) return false;
-	Node<ItemType>* curPtr = headPtr;
-	headPtr = headPtr->getNext();
+	if (head.getNext() == nullptr) return false;
+	Node<ItemType>* curPtr = head.getNext();
+	head.setNext(head.getNext()->getNext());
+	if (head.getNext() == nullptr)
+		tailPtr = nullptr;
 	--itemCount;
 	freeListEl(curPtr);
-	TraverseOK = false;
+	resetCursor();
 	return true;
 }
+// Walk down the List once keeping the last Node kept
+// Unlink each Node pred is true for and retire it onto a chain
+// The last Node kept is the new tail
+// Return the chain to Allocator in one batch
+// pred must not throw, the Nodes retired so far would be lost
+template<class ItemType, class Allocator>
+template<class Predicate>
+int LinkedList<ItemType, Allocator>::remove_if(Predicate pred)
+{
+	NodeBase<ItemType>* prevPtr = &head;
+	Node<ItemType>* curPtr = head.getNext(), *chain = nullptr, *chainLast = nullptr;
+	int removed = 0;
+	while (curPtr != nullptr)
+	{
+		Node<ItemType>* nextPtr = curPtr->getNext();
+		if (pred(curPtr->getItem()))
+		{
+			prevPtr->setNext(nextPtr);
+			if (chainLast == nullptr)
+				chainLast = curPtr;
+			chain = retireListEl(curPtr, chain);
+			++removed;
+		}
+		else
+			prevPtr = curPtr;
+		curPtr = nextPtr;
+	}
+	tailPtr = (prevPtr == &head) ? nullptr : static_cast<Node<ItemType>*>(prevPtr);
+	itemCount -= removed;
+	freeChain(chain, chainLast, removed);
+	if (removed > 0)
+		resetCursor();
+	return removed;
+}
+template<class ItemType, class Allocator>
+int LinkedList<ItemType, Allocator>::remove_all(const ItemType& value)
+{
+	EqualTo pred = { &value };
+	return remove_if(pred);
+}
+// Sort a copy of the keys so each item is one binary search
+// O((n + k) log k) for n items and k keys
+template<class ItemType, class Allocator>
+template<class InputIt>
+int LinkedList<ItemType, Allocator>::remove_all(InputIt first, InputIt last)
+{
+	std::vector<ItemType> keys(first, last);
+	if (keys.empty() || itemCount == 0) return 0;
+	std::sort(keys.begin(), keys.end());
+	InKeys pred = { &keys };
+	return remove_if(pred);
+}
+// Compare each Node with the last Node kept
+// Unlink and retire it if equal, else it becomes the last kept
+// The last Node kept is the new tail
+template<class ItemType, class Allocator>
+int LinkedList<ItemType, Allocator>::unique(void)
+{
+	if (itemCount < 2) return 0;
+	Node<ItemType>* keptPtr = head.getNext(), *curPtr = keptPtr->getNext(), *chain = nullptr, *chainLast = nullptr;
+	int removed = 0;
+	while (curPtr != nullptr)
+	{
+		Node<ItemType>* nextPtr = curPtr->getNext();
+		if (curPtr->getItem() == keptPtr->getItem())
+		{
+			keptPtr->setNext(nextPtr);
+			if (chainLast == nullptr)
+				chainLast = curPtr;
+			chain = retireListEl(curPtr, chain);
+			++removed;
+		}
+		else
+			keptPtr = curPtr;
+		curPtr = nextPtr;
+	}
+	tailPtr = keptPtr;
+	itemCount -= removed;
+	freeChain(chain, chainLast, removed);
+	if (removed > 0)
+		resetCursor();
+	return removed;
+}
 // Check if Linked List has zero Nodes
-template<class ItemType>
-bool LinkedList<ItemType>::isEmpty() const
+template<class ItemType, class Allocator>
+bool LinkedList<ItemType, Allocator>::isEmpty() const
 {
 	return itemCount == 0;
 }
-// If the list is empty and new length is greater than thisList's length
-//  or if the resize value is equal to thisList's length then exit
-// If thisList is any size and the user wants to resize it to zero
-//  delete thisList
-// Else increase or decrease the size of thisList
-// If increasing, push/insert Nodes into thisList
-// If decreasing,
-template<class ItemType>
-void LinkedList<ItemType>::resize(int len, const ItemType& value)
+// If the resize value is equal to thisList's length then exit
+// If the user wants to resize it to zero, clear thisList
+// If increasing, link len - itemCount copies of value after the
+//  tail, all allocated in one burst
+// If decreasing, cut thisList after position len and free the rest,
+//  the cursor may point past the new end, so forget it
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::resize(int len, const ItemType& value)
 {
 	assert(len >= 0);
-	if (len == itemCount) return *this;
-	else if ((itemCount >= 1) && (len == 0))
-		while (!isEmpty()) pop();
+	if (len == itemCount) return;
+	else if (len == 0)
+		clear();
+	else if (len > itemCount)
+	{
+		FillIterator fill = { &value };
+		linkRange((tailPtr != nullptr) ? tailPtr : &head, fill, len - itemCount);
+	}
 	else
 	{
-		bool remove = ((len < itemCount) ? (true) : (false));
-		Node<ItemType> *curPtr, *nextPtr;
-		TraverseOK = false;
-		if (itemCount == 0)
-			push(value);
-		if (itemCount == 0 || itemCount == 1)
-			curPtr = getNodeAt(1);
-		else
-			curPtr = getNodeAt(((remove) ? (len) : (itemCount)));
-		while (itemCount != len)
+		Node<ItemType> *curPtr = getNodeAt(len), *nextPtr = curPtr->getNext(), *prevPtr;
+		curPtr->setNext(nullptr);
+		tailPtr = curPtr;
+		while (nextPtr != nullptr)
 		{
-			if (remove)
-			{
-				nextPtr = curPtr->getNext();
-				curPtr->setNext((nextPtr != nullptr) ? (nextPtr->getNext()) : (nullptr));
-				freeListEl(nextPtr);
-			}
-			else
-			{
-				Node<ItemType> *newEntry = getListEl();
-				curPtr->setNext(newEntry);
-				curPtr = curPtr->getNext();
-			}
-			itemCount += ((remove) ? (-1) : (1));
+			prevPtr = nextPtr;
+			nextPtr = nextPtr->getNext();
+			freeListEl(prevPtr);
 		}
+		itemCount = len;
+		resetCursor();
 	}
-	return *this;
 }
-// Iterate down Linked List deleting Nodes
-// Zero out thisList
-// Iterate down Free List deleting Nodes
-// Zero out Free List
-template<class ItemType>
-void LinkedList<ItemType>::clear()
+// Overwrite thisList's items in order while both last
+// If the range is longer, link the rest of it after the last Node
+// Else cut thisList after the last Node overwritten and free the rest
+template<class ItemType, class Allocator>
+template<class InputIt>
+void LinkedList<ItemType, Allocator>::assign(InputIt first, InputIt last)
 {
-	Node<ItemType>* curPtr = headPtr, *prevPtr;
-	TraverseOK = false;
-	while (curPtr != nullptr)
+	NodeBase<ItemType>* prevPtr = &head;
+	Node<ItemType>* curPtr = head.getNext();
+	int count = 0;
+	for (; curPtr != nullptr && first != last; ++first, ++count)
 	{
+		curPtr->setItem(*first);
 		prevPtr = curPtr;
 		curPtr = curPtr->getNext();
-		delete prevPtr;
 	}
-	curPtr = free;
+	if (first != last)
+		insertAfter(prevPtr, first, last, typename std::iterator_traits<InputIt>::iterator_category());
+	else if (curPtr != nullptr)
+	{
+		prevPtr->setNext(nullptr);
+		tailPtr = (prevPtr == &head) ? nullptr : static_cast<Node<ItemType>*>(prevPtr);
+		while (curPtr != nullptr)
+		{
+			prevPtr = curPtr;
+			curPtr = curPtr->getNext();
+			freeListEl(static_cast<Node<ItemType>*>(prevPtr));
+		}
+		itemCount = count;
+	}
+	resetCursor();
+}
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::assign(std::initializer_list<ItemType> anInitList)
+{
+	assign(anInitList.begin(), anInitList.end());
+}
+// Up to the user to enter a legal position
+// Link the range after position - 1 (or head)
+// A cursor past position - 1 moves down by the count inserted
+template<class ItemType, class Allocator>
+template<class InputIt>
+void LinkedList<ItemType, Allocator>::insert_range(int position, InputIt first, InputIt last)
+{
+	assert((position >= 1) && (position <= itemCount + 1));
+	NodeBase<ItemType>* prevPtr = &head;
+	if (position > 1)
+		prevPtr = getNodeAt(position - 1);
+	int count = insertAfter(prevPtr, first, last, typename std::iterator_traits<InputIt>::iterator_category());
+	if (cursorPos >= position) cursorPos += count;
+}
+// Iterate down Linked List returning Nodes to Allocator
+// Zero out thisList
+// Other lists' recycled Nodes are left alone
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::clear()
+{
+	Node<ItemType>* curPtr = head.getNext(), *prevPtr;
 	while (curPtr != nullptr)
 	{
 		prevPtr = curPtr;
 		curPtr = curPtr->getNext();
-		delete prevPtr;
+		freeListEl(prevPtr);
 	}
-	free = nullptr;
+	head.setNext(nullptr);
+	tailPtr = nullptr;
+	itemCount = 0;
+	resetCursor();
 }
-// If direction == 1, then iterate down thisList printing items
-// Else recurse up thisList then print items
-template<class ItemType>
-void  LinkedList<ItemType>::printList(int direction) const
+// Forward prints items back to back, Reverse a space after each,
+// through a buffer on stdout
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::printList(int direction) const
+{
+	ListWriter out(std::cout);
+	printList(out, direction, direction == Forward ? "" : " ");
+	if (direction != Forward && itemCount > 0) out << ' ';
+}
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::printList(std::ostream& os, int direction, const char* separator) const
+{
+	ListWriter out(os);
+	printList(out, direction, separator);
+}
+// If direction == 1, then iterate down thisList writing items
+// Else write items back to front through printRev
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::printList(ListWriter& out, int direction, const char* separator) const
 {
-	Node<ItemType>* curPtr = headPtr;
 	if (direction == Forward)
 	{
-		while (curPtr != NULL)
+		for (const Node<ItemType>* curPtr = head.getNext(); curPtr != nullptr; curPtr = curPtr->getNext())
 		{
-			std::cout << curPtr->getItem();
-			curPtr = curPtr->getNext();
+			if (curPtr != head.getNext()) out << separator;
+			out << curPtr->getItem();
 		}
 	}
 	else
-		printRevHelper(curPtr);
+		printRev(out, separator);
 }
-// Creates a new List and copies thisList's items into newList's items
-template<class ItemType>
-LinkedList<ItemType>& LinkedList<ItemType>::subStr(int position, int len)
+// Creates a new List and copies len items from position on to its tail
+// newList is returned by value, which moves its Nodes out in O(1)
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator> LinkedList<ItemType, Allocator>::subStr(int position, int len) const
 {
 	assert((position >= 1) && (position <= itemCount));
-	TraverseOK = false;
-	LinkedList<ItemType> *newList = new LinkedList<ItemType>;
-	if (position == itemCount)
-		return *newList;
-	Node<ItemType> *curPtr = getNodeAt(position);
-	substrHelper(curPtr, *newList, len);
-	return *newList;
+	assert((len >= 0) && (position + len - 1 <= itemCount));
+	LinkedList<ItemType, Allocator> newList;
+	Node<ItemType> *curPtr = (len != 0) ? findNodeAt(position) : nullptr;
+	for (; len != 0; --len, curPtr = curPtr->getNext())
+		newList.push_back(curPtr->getItem());
+	return newList;
 }
-// Appends thisList to aList
-//sets aList headPtr to null
-template<class ItemType>
-LinkedList<ItemType> &LinkedList<ItemType>::append(LinkedList<ItemType>& aList)
-{
-	if (aList.headPtr == nullptr) return *this;
-	TraverseOK = false;
-	// find node to start insert
-	Node<ItemType> *curPtr;
-	if (headPtr == nullptr)
-		curPtr = headPtr;
+// Takes over aList's Nodes, linking them after tailPtr
+// sets aList's head to null
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator> &LinkedList<ItemType, Allocator>::append(LinkedList<ItemType, Allocator>& aList)
+{
+	splice_after(const_iterator(tailPtr != nullptr ? tailPtr : &head), aList);
+	return *this;
+}
+// Links aList's chain between position and position's next
+// If position was the last Node (or thisList was empty),
+// aList's tail becomes thisList's tail
+// sets aList's head to null
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::splice_after(const_iterator position, LinkedList<ItemType, Allocator>& aList)
+{
+	assert(this != &aList);
+	if (aList.head.getNext() == nullptr) return;
+	NodeBase<ItemType> *curPtr = position.curPtr;
+	aList.tailPtr->setNext(curPtr->getNext());
+	if (curPtr->getNext() == nullptr)
+		tailPtr = aList.tailPtr;
 	else
-		curPtr = getNodeAt(itemCount);
-	// deep copy from aList
-	Node<ItemType> *cpy = aList.headPtr;
-	while (cpy != nullptr)
-	{
-		Node<ItemType> *newNode = getListEl();
-		newNode->setItem(cpy->getItem());
-		newNode->setNext(nullptr);
-		if (headPtr == nullptr)
+		resetCursor();
+	curPtr->setNext(aList.head.getNext());
+	itemCount += aList.itemCount;
+	aList.head.setNext(nullptr);
+	aList.tailPtr = nullptr;
+	aList.itemCount = 0;
+	aList.resetCursor();
+}
+// Walk thisList once, pointing each Node back at the one before it
+// The old first Node is the new tail, the old last is the new first
+template<class ItemType, class Allocator>
+LinkedList<ItemType, Allocator> &LinkedList<ItemType, Allocator>::reverse(void)
+{
+	Node<ItemType> *curPtr = head.getNext(), *prevPtr = nullptr, *nextPtr;
+	tailPtr = curPtr;
+	while (curPtr != nullptr)
+	{
+		nextPtr = curPtr->getNext();
+		curPtr->setNext(prevPtr);
+		prevPtr = curPtr;
+		curPtr = nextPtr;
+	}
+	head.setNext(prevPtr);
+	resetCursor();
+	return *this;
+}
+// Step len - 1 Nodes down the chain, then cut it after that Node
+template<class ItemType, class Allocator>
+Node<ItemType>* LinkedList<ItemType, Allocator>::splitAfter(Node<ItemType>* curPtr, int len)
+{
+	for (; curPtr != nullptr && len > 1; --len)
+		curPtr = curPtr->getNext();
+	if (curPtr == nullptr) return nullptr;
+	Node<ItemType>* restPtr = curPtr->getNext();
+	curPtr->setNext(nullptr);
+	return restPtr;
+}
+// Inchworm down both chains, linking the smaller front Node after tail
+// rhs only goes first if it is strictly smaller, so equal items keep order
+// Link whatever chain is left and walk to its last Node
+template<class ItemType, class Allocator>
+template<class Compare>
+NodeBase<ItemType>* LinkedList<ItemType, Allocator>::mergeChains(Node<ItemType>* lhs, Node<ItemType>* rhs, NodeBase<ItemType>* tail, Compare& comp)
+{
+	while (lhs != nullptr && rhs != nullptr)
+	{
+		if (comp(rhs->getItem(), lhs->getItem()))
 		{
-			headPtr = newNode;
-			curPtr = headPtr;
+			tail->setNext(rhs);
+			tail = rhs;
+			rhs = rhs->getNext();
 		}
 		else
 		{
-			curPtr->setNext(newNode);
-			curPtr = curPtr->getNext();
+			tail->setNext(lhs);
+			tail = lhs;
+			lhs = lhs->getNext();
 		}
-		cpy = cpy->getNext();
-		++itemCount;
 	}
-	aList.headPtr = nullptr;
+	tail->setNext((lhs != nullptr) ? lhs : rhs);
+	while (tail->getNext() != nullptr)
+		tail = tail->getNext();
+	return tail;
+}
+// Sorts with operator<
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::sort(void)
+{
+	sort(std::less<ItemType>());
+}
+// Merge runs of width 1, 2, 4, ... until one run covers thisList
+// Each pass cuts two runs off the front of what is left,
+// merges them after the last merged Node and moves on
+// Only a few pointers are kept, no recursion or scratch array
+// The last merged Node of the last pass is the new tail
+template<class ItemType, class Allocator>
+template<class Compare>
+void LinkedList<ItemType, Allocator>::sort(Compare comp)
+{
+	if (itemCount < 2) return;
+	NodeBase<ItemType>* tail = &head;
+	for (int width = 1; width < itemCount; width *= 2)
+	{
+		Node<ItemType>* curPtr = head.getNext();
+		tail = &head;
+		while (curPtr != nullptr)
+		{
+			Node<ItemType>* lhs = curPtr;
+			Node<ItemType>* rhs = splitAfter(lhs, width);
+			curPtr = splitAfter(rhs, width);
+			tail = mergeChains(lhs, rhs, tail, comp);
+		}
+	}
+	tailPtr = static_cast<Node<ItemType>*>(tail);
+	resetCursor();
+}
+// Merges with operator<
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::merge(LinkedList<ItemType, Allocator>& aList)
+{
+	merge(aList, std::less<ItemType>());
+}
+// If aList's first item doesn't go before thisList's last, it is an append
+// Else relink both chains in order after head
+// Take over aList's count, leave aList empty
+template<class ItemType, class Allocator>
+template<class Compare>
+void LinkedList<ItemType, Allocator>::merge(LinkedList<ItemType, Allocator>& aList, Compare comp)
+{
+	assert(this != &aList);
+	if (aList.head.getNext() == nullptr) return;
+	if (tailPtr == nullptr || !comp(aList.head.getNext()->getItem(), tailPtr->getItem()))
+	{
+		append(aList);
+		return;
+	}
+	NodeBase<ItemType>* tail = mergeChains(head.getNext(), aList.head.getNext(), &head, comp);
+	tailPtr = static_cast<Node<ItemType>*>(tail);
+	itemCount += aList.itemCount;
+	resetCursor();
+	aList.head.setNext(nullptr);
+	aList.tailPtr = nullptr;
 	aList.itemCount = 0;
-	return *this;
+	aList.resetCursor();
 }
-// Recursively reverses thisList
-template<class ItemType>
-LinkedList<ItemType> &LinkedList<ItemType>::reverse(void)
+// Ties go to the lower source
+template<class ItemType, class Allocator>
+template<class Compare>
+inline bool LinkedList<ItemType, Allocator>::sourceBefore(const MergeSource& lhs, const MergeSource& rhs, Compare& comp)
 {
-	TraverseOK = false;
-	reverseHelper(headPtr);
-	return *this;
+	if (comp(lhs.front->getItem(), rhs.front->getItem())) return true;
+	if (comp(rhs.front->getItem(), lhs.front->getItem())) return false;
+	return lhs.source < rhs.source;
 }
-template<class ItemType>
-void LinkedList<ItemType>::deleteList(void)
+// Hold the entry aside and pull the child that goes first up
+// into the hole until the entry goes before both children
+template<class ItemType, class Allocator>
+template<class Compare>
+void LinkedList<ItemType, Allocator>::siftDown(std::vector<MergeSource>& heap, int index, Compare& comp)
 {
-	Node<ItemType> *curPtr = headPtr;
-	while (curPtr != nullptr)
+	int size = int(heap.size());
+	MergeSource entry = heap[index];
+	for (int child = 2 * index + 1; child < size; child = 2 * index + 1)
+	{
+		if (child + 1 < size && sourceBefore(heap[child + 1], heap[child], comp))
+			++child;
+		if (!sourceBefore(heap[child], entry, comp))
+			break;
+		heap[index] = heap[child];
+		index = child;
+	}
+	heap[index] = entry;
+}
+// Merges with operator<
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::merge_all(LinkedList<ItemType, Allocator>* const* lists, int count, bool dedupe)
+{
+	merge_all(lists, count, std::less<ItemType>(), dedupe);
+}
+// Take over thisList's chain and every list's chain as sources,
+// thisList first, and heapify their fronts
+// Repeatedly unlink the front Node of the top source, step that
+// source to its next Node (or drop it if that was its last) and
+// sift it down
+// With dedupe, retire the Node if it doesn't go after the last
+// Node linked, else link it after tail
+// Without dedupe, once one source is left link the rest of its
+// chain as is and take its back as the new tail
+// Free the retired Nodes in one batch
+template<class ItemType, class Allocator>
+template<class Compare>
+void LinkedList<ItemType, Allocator>::merge_all(LinkedList<ItemType, Allocator>* const* lists, int count, Compare comp, bool dedupe)
+{
+	std::vector<MergeSource> heap;
+	heap.reserve(count + 1);
+	int total = 0;
+	for (int i = -1; i < count; ++i)
+	{
+		LinkedList<ItemType, Allocator>* aList = (i < 0) ? this : lists[i];
+		if (aList == nullptr || (i >= 0 && aList == this) || aList->head.getNext() == nullptr) continue;
+		MergeSource aSource = { aList->head.getNext(), aList->tailPtr, i + 1 };
+		heap.push_back(aSource);
+		total += aList->itemCount;
+		aList->head.setNext(nullptr);
+		aList->tailPtr = nullptr;
+		aList->itemCount = 0;
+		aList->resetCursor();
+	}
+	for (int i = int(heap.size()) / 2 - 1; i >= 0; --i)
+		siftDown(heap, i, comp);
+	NodeBase<ItemType>* tail = &head;
+	Node<ItemType>* chain = nullptr, *chainLast = nullptr;
+	int removed = 0;
+	while (!heap.empty())
+	{
+		if (heap.size() == 1 && !dedupe)
+		{
+			tail->setNext(heap[0].front);
+			tail = heap[0].back;
+			break;
+		}
+		Node<ItemType>* curPtr = heap[0].front;
+		if (curPtr != heap[0].back)
+			heap[0].front = curPtr->getNext();
+		else
+		{
+			heap[0] = heap.back();
+			heap.pop_back();
+		}
+		if (!heap.empty())
+			siftDown(heap, 0, comp);
+		if (dedupe && tail != &head && !comp(static_cast<Node<ItemType>*>(tail)->getItem(), curPtr->getItem()))
+		{
+			if (chainLast == nullptr)
+				chainLast = curPtr;
+			chain = retireListEl(curPtr, chain);
+			++removed;
+		}
+		else
+		{
+			tail->setNext(curPtr);
+			tail = curPtr;
+		}
+	}
+	tail->setNext(nullptr);
+	tailPtr = (tail == &head) ? nullptr : static_cast<Node<ItemType>*>(tail);
+	itemCount = total - removed;
+	freeChain(chain, chainLast, removed);
+}
+// Walk thisList once, moving each item out and keeping its Node
+// Sort the Nodes by address and move the items back in list order,
+// the lowest Node getting the first item
+// Relink the Nodes in that order, nothing is allocated or freed
+// With a SlabAllocator the Nodes sit in a few slabs, so the List
+// then reads mostly front to back through memory
+template<class ItemType, class Allocator>
+void LinkedList<ItemType, Allocator>::compact(void)
+{
+	if (itemCount < 2) return;
+	std::vector<Node<ItemType>*> nodes;
+	std::vector<ItemType> items;
+	nodes.reserve(itemCount);
+	items.reserve(itemCount);
+	for (Node<ItemType>* curPtr = head.getNext(); curPtr != nullptr; curPtr = curPtr->getNext())
+	{
+		nodes.push_back(curPtr);
+		items.push_back(std::move(curPtr->getItem()));
+	}
+	std::sort(nodes.begin(), nodes.end(), std::less<Node<ItemType>*>());
+	NodeBase<ItemType>* prevPtr = &head;
+	for (int i = 0; i < itemCount; ++i)
 	{
-		pop();
-		curPtr = headPtr;
+		nodes[i]->setItem(std::move(items[i]));
+		prevPtr->setNext(nodes[i]);
+		prevPtr = nodes[i];
 	}
+	nodes.back()->setNext(nullptr);
+	tailPtr = nodes.back();
+	resetCursor();
+}
+// Same as clear, one pass returning Nodes to Allocator
+template<class ItemType, class Allocator>
+inline void LinkedList<ItemType, Allocator>::deleteList(void)
+{
+	clear();
+}
+// Points at the first Node (end if empty)
+template<class ItemType, class Allocator>
+inline typename LinkedList<ItemType, Allocator>::iterator LinkedList<ItemType, Allocator>::begin(void)
+{
+	return iterator(head.getNext());
+}
+template<class ItemType, class Allocator>
+inline typename LinkedList<ItemType, Allocator>::const_iterator LinkedList<ItemType, Allocator>::begin(void) const
+{
+	return const_iterator(head.getNext());
+}
+template<class ItemType, class Allocator>
+inline typename LinkedList<ItemType, Allocator>::const_iterator LinkedList<ItemType, Allocator>::cbegin(void) const
+{
+	return const_iterator(head.getNext());
+}
+// The last Node's next is nullptr, so end is nullptr
+template<class ItemType, class Allocator>
+inline typename LinkedList<ItemType, Allocator>::iterator LinkedList<ItemType, Allocator>::end(void)
+{
+	return iterator(nullptr);
+}
+template<class ItemType, class Allocator>
+inline typename LinkedList<ItemType, Allocator>::const_iterator LinkedList<ItemType, Allocator>::end(void) const
+{
+	return const_iterator(nullptr);
+}
+template<class ItemType, class Allocator>
+inline typename LinkedList<ItemType, Allocator>::const_iterator LinkedList<ItemType, Allocator>::cend(void) const
+{
+	return const_iterator(nullptr);
+}
+// Points at head itself, whose next is the first Node
+template<class ItemType, class Allocator>
+inline typename LinkedList<ItemType, Allocator>::iterator LinkedList<ItemType, Allocator>::before_begin(void)
+{
+	return iterator(&head);
+}
+template<class ItemType, class Allocator>
+inline typename LinkedList<ItemType, Allocator>::const_iterator LinkedList<ItemType, Allocator>::before_begin(void) const
+{
+	return const_iterator(const_cast<NodeBase<ItemType>*>(&head));
+}
+template<class ItemType, class Allocator>
+inline typename LinkedList<ItemType, Allocator>::const_iterator LinkedList<ItemType, Allocator>::cbefore_begin(void) const
+{
+	return const_iterator(const_cast<NodeBase<ItemType>*>(&head));
 }
 #if 0 // #if 1 to compile as a standalone program, not a library
 int main()
 {
 	int choice = 0, key, position;
-	Node<int> d, *e;
 	LinkedList<int> list;
+	LinkedList<int>::iterator e;
 	LinkedList<int> temp;
 	temp.push(3);
 	temp.push(2);
@@ -778,27 +1696,26 @@ int main()
 			std::cout << " : " << list.getLength() << std::endl;
 			break;
 		case 10:
-			e = list.traverse(true);
-			if (e == nullptr)
+			e = list.begin();
+			if (e == list.end())
 				std::cout << "There is no first key!\n";
 			else
-				std::cout << "Node has data " << e->getItem() << std::endl;
+				std::cout << "Node has data " << *e << std::endl;
 			break;
 		case 11:
-			e = list.traverse(false);
-			if (e == nullptr)
+			if (e == list.end() || ++e == list.end())
 				std::cout << "There is no next key!\n";
 			else
-				std::cout << "Node has data " << e->getItem() << std::endl;
+				std::cout << "Node has data " << *e << std::endl;
 			break;
 		case 12:
 			std::cout << "Enter position : " << std::flush;
 			std::cin >> position;
 			std::cout << "Enter number of characters : " << std::flush;
 			std::cin >> key;
-			if (key > list.getLength() ||
+			if (key < 0 ||
 				position < 1 ||
-				position > list.getLength())
+				position + key - 1 > list.getLength())
 				std::cout << "That goes out of range!\n" << std::endl;
 			else
 				(list.subStr(position, key)).printList(1);
@@ -833,4 +1750,5 @@ int main()
 	return 0;
 }
 #endif
+#endif
 
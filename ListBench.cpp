@@ -0,0 +1,392 @@
+/*
+* ListBench.cpp
+* Daniel Salazar
+* 10/18/2026
+* Benchmark of LinkedList.h against std::forward_list, std::list
+* and std::vector, for int, double and std::string items
+* For every size from 10 up to maxSize (by 10x) and every container
+* it times push, pop, insert (random position), insertSorted, remove,
+* isInList, append, reverse, copy and traversal, and reports
+* nanoseconds and heap allocations per op, then the peak RSS
+* push and pop work at the front of the Lists, at the back of the
+* vector; isInList searches a sorted container; reverse, copy and
+* traversal are reported per item
+* insert, insertSorted and remove change a container by at most a
+* tenth of n, so each row measures the size it is labelled with
+* Usage: ListBench [maxSize] [milliseconds per measurement]
+*/
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <forward_list>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include "LinkedList.h"
+// Every heap request goes through here and is counted
+// Array and sized forms are replaced too, so every new is paired
+// with a delete on the same malloc/free
+// All of them stay out of line, else GCC inlines malloc or free
+// into callers and flags it against the other side of the pair
+#if defined(__GNUC__) || defined(__clang__)
+#define BENCH_NOINLINE __attribute__((noinline))
+#else
+#define BENCH_NOINLINE
+#endif
+static long long allocations = 0;
+BENCH_NOINLINE void* operator new(std::size_t size)
+{
+	++allocations;
+	void* ptr = std::malloc(size == 0 ? 1 : size);
+	if (ptr == nullptr) throw std::bad_alloc();
+	return ptr;
+}
+BENCH_NOINLINE void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+BENCH_NOINLINE void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+BENCH_NOINLINE void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+BENCH_NOINLINE void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+BENCH_NOINLINE void operator delete[](void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+// Small generator so every container sees the same values
+struct XorShift
+{
+	unsigned int state;
+	unsigned int next()
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+};
+// Item for value i, ordered like i
+template<class ItemType>
+ItemType makeItem(int i)
+{
+	return ItemType(i);
+}
+// Ten digits, zero padded so strings sort like numbers, short
+// enough for the small string buffer
+template<>
+std::string makeItem<std::string>(int i)
+{
+	char digits[16];
+	std::snprintf(digits, sizeof(digits), "%010d", i);
+	return digits;
+}
+// Folds an item into a checksum so traversal isn't optimized away
+inline long long touch(int anItem) { return anItem; }
+inline long long touch(double anItem) { return (long long)anItem; }
+inline long long touch(const std::string& anItem) { return (long long)anItem.size() + anItem[9]; }
+// Walk a sorted range until an item isn't less than x, like
+// LinkedList::isInList
+template<class ForwardIt, class ItemType>
+bool sortedFind(ForwardIt first, ForwardIt last, const ItemType& x)
+{
+	while (first != last && *first < x)
+		++first;
+	return first != last && *first == x;
+}
+// One interface over the four containers
+// isInList searches a sorted container, as LinkedList::isInList does
+// size is passed in where a container can't tell it in O(1)
+template<class Container>
+struct ContainerOps;
+template<class ItemType>
+struct ContainerOps<LinkedList<ItemType> >
+{
+	typedef LinkedList<ItemType> Container;
+	static void push(Container& c, const ItemType& x) { c.push(x); }
+	static void pop(Container& c) { c.pop(); }
+	static void insertAt(Container& c, int index, const ItemType& x) { c.insert(index + 1, x); }
+	static void insertSorted(Container& c, const ItemType& x) { c.insertSorted(x); }
+	static bool remove(Container& c, const ItemType& x) { return c.remove(x); }
+	static bool isInList(Container& c, const ItemType& x) { return c.isInList(x); }
+	static void append(Container& a, Container& b) { a.append(b); }
+	static void reverse(Container& c) { c.reverse(); }
+};
+template<class ItemType>
+struct ContainerOps<std::forward_list<ItemType> >
+{
+	typedef std::forward_list<ItemType> Container;
+	static void push(Container& c, const ItemType& x) { c.push_front(x); }
+	static void pop(Container& c) { c.pop_front(); }
+	static void insertAt(Container& c, int index, const ItemType& x) { c.insert_after(std::next(c.before_begin(), index), x); }
+	// After equal items, like LinkedList
+	static void insertSorted(Container& c, const ItemType& x)
+	{
+		typename Container::iterator prev = c.before_begin();
+		for (typename Container::iterator cur = c.begin(); cur != c.end() && !(x < *cur); ++cur)
+			prev = cur;
+		c.insert_after(prev, x);
+	}
+	static bool remove(Container& c, const ItemType& x)
+	{
+		typename Container::iterator prev = c.before_begin();
+		for (typename Container::iterator cur = c.begin(); cur != c.end(); prev = cur++)
+			if (*cur == x)
+			{
+				c.erase_after(prev);
+				return true;
+			}
+		return false;
+	}
+	static bool isInList(Container& c, const ItemType& x) { return sortedFind(c.begin(), c.end(), x); }
+	// No tail, so walk to a's last item first
+	static void append(Container& a, Container& b)
+	{
+		typename Container::iterator last = a.before_begin();
+		for (typename Container::iterator cur = a.begin(); cur != a.end(); ++cur)
+			last = cur;
+		a.splice_after(last, b);
+	}
+	static void reverse(Container& c) { c.reverse(); }
+};
+template<class ItemType>
+struct ContainerOps<std::list<ItemType> >
+{
+	typedef std::list<ItemType> Container;
+	static void push(Container& c, const ItemType& x) { c.push_front(x); }
+	static void pop(Container& c) { c.pop_front(); }
+	static void insertAt(Container& c, int index, const ItemType& x) { c.insert(std::next(c.begin(), index), x); }
+	static void insertSorted(Container& c, const ItemType& x)
+	{
+		typename Container::iterator cur = c.begin();
+		while (cur != c.end() && !(x < *cur))
+			++cur;
+		c.insert(cur, x);
+	}
+	static bool remove(Container& c, const ItemType& x)
+	{
+		typename Container::iterator cur = std::find(c.begin(), c.end(), x);
+		if (cur == c.end()) return false;
+		c.erase(cur);
+		return true;
+	}
+	static bool isInList(Container& c, const ItemType& x) { return sortedFind(c.begin(), c.end(), x); }
+	static void append(Container& a, Container& b) { a.splice(a.end(), b); }
+	static void reverse(Container& c) { c.reverse(); }
+};
+template<class ItemType>
+struct ContainerOps<std::vector<ItemType> >
+{
+	typedef std::vector<ItemType> Container;
+	static void push(Container& c, const ItemType& x) { c.push_back(x); }
+	static void pop(Container& c) { c.pop_back(); }
+	static void insertAt(Container& c, int index, const ItemType& x) { c.insert(c.begin() + index, x); }
+	// Binary search, then shift the rest up
+	static void insertSorted(Container& c, const ItemType& x) { c.insert(std::upper_bound(c.begin(), c.end(), x), x); }
+	static bool remove(Container& c, const ItemType& x)
+	{
+		typename Container::iterator cur = std::find(c.begin(), c.end(), x);
+		if (cur == c.end()) return false;
+		c.erase(cur);
+		return true;
+	}
+	// Binary search
+	static bool isInList(Container& c, const ItemType& x) { return std::binary_search(c.begin(), c.end(), x); }
+	static void append(Container& a, Container& b)
+	{
+		a.insert(a.end(), std::make_move_iterator(b.begin()), std::make_move_iterator(b.end()));
+		b.clear();
+	}
+	static void reverse(Container& c) { std::reverse(c.begin(), c.end()); }
+};
+// Cost of one op
+struct Result
+{
+	double nsPerOp;
+	double allocsPerOp;
+};
+// Run setup (untimed) then body (timed, returns ops it did) in
+// rounds until minOps ops are done or milliseconds have passed,
+// and at least one round ran
+template<class Setup, class Body>
+Result measure(Setup setup, Body body, long long minOps, int milliseconds)
+{
+	typedef std::chrono::steady_clock Clock;
+	Clock::time_point start = Clock::now();
+	long long ops = 0, allocs = 0;
+	double seconds = 0;
+	while (ops == 0 || (ops < minOps && Clock::now() - start < std::chrono::milliseconds(milliseconds)))
+	{
+		setup();
+		long long before = allocations;
+		Clock::time_point t0 = Clock::now();
+		ops += body();
+		seconds += std::chrono::duration<double>(Clock::now() - t0).count();
+		allocs += allocations - before;
+	}
+	Result result = { seconds * 1e9 / ops, double(allocs) / ops };
+	return result;
+}
+// Written once per container so the checksums can't be optimized away
+static volatile long long sink = 0;
+// Order of the rows in the report
+enum { Push, Pop, Insert, InsertSorted, Remove, IsInList, Append, Reverse, Copy, Traverse, OpCount };
+static const char* opNames[OpCount] = { "push", "pop", "insert", "insertSorted", "remove", "isInList",
+	"append", "reverse", "copy", "traverse" };
+// Measures every op on Container for n items
+// items holds the values 0, 2, 4, ... shuffled; probes holds odd
+// values, which are never in a container until inserted; positions
+// holds random numbers that pick where insert goes
+template<class Container>
+void benchContainer(int n, const std::vector<typename Container::value_type>& items,
+	const std::vector<typename Container::value_type>& sortedItems,
+	const std::vector<typename Container::value_type>& probes, const std::vector<unsigned int>& positions,
+	int milliseconds, Result results[OpCount])
+{
+	typedef ContainerOps<Container> Ops;
+	// Ops that walk the container do about 2 million steps a round
+	const int walkOps = std::max(1, std::min(1000, 2000000 / n));
+	const int endOps = 1000;
+	// Ops that grow or shrink a container do at most a tenth of n on
+	// each, spread over enough fresh copies to make up walkOps
+	const int sizeOps = std::max(1, std::min(walkOps, n / 10));
+	const int copyCount = walkOps / sizeOps;
+	std::unique_ptr<Container> c, other;
+	std::vector<Container> copies;
+	long long checksum = 0;
+	results[Push] = measure([&]() { c.reset(new Container(items.begin(), items.end())); },
+		[&]() { for (int i = 0; i < endOps; ++i) Ops::push(*c, probes[i % probes.size()]); return endOps; },
+		100000, milliseconds);
+	results[Pop] = measure([&]()
+		{
+			c.reset(new Container(items.begin(), items.end()));
+			for (int i = 0; i < endOps; ++i) Ops::push(*c, probes[i % probes.size()]);
+		},
+		[&]() { for (int i = 0; i < endOps; ++i) Ops::pop(*c); return endOps; },
+		100000, milliseconds);
+	// Every container gets the same random positions, so none of them
+	// inserts next to where it inserted last
+	results[Insert] = measure([&]() { copies.assign(copyCount, Container(items.begin(), items.end())); },
+		[&]()
+		{
+			for (int k = 0, op = 0; k < copyCount; ++k)
+				for (int i = 0; i < sizeOps; ++i, ++op)
+					Ops::insertAt(copies[k], int(positions[op % positions.size()] % (n + i + 1)), probes[op % probes.size()]);
+			return copyCount * sizeOps;
+		},
+		10000, milliseconds);
+	results[InsertSorted] = measure([&]() { copies.assign(copyCount, Container(sortedItems.begin(), sortedItems.end())); },
+		[&]()
+		{
+			for (int k = 0, op = 0; k < copyCount; ++k)
+				for (int i = 0; i < sizeOps; ++i, ++op)
+					Ops::insertSorted(copies[k], probes[op % probes.size()]);
+			return copyCount * sizeOps;
+		},
+		10000, milliseconds);
+	results[Remove] = measure([&]() { copies.assign(copyCount, Container(items.begin(), items.end())); },
+		[&]()
+		{
+			for (int k = 0; k < copyCount; ++k)
+				for (int i = 0; i < sizeOps; ++i)
+					checksum += Ops::remove(copies[k], sortedItems[(i * 7919u) % n]);
+			return copyCount * sizeOps;
+		},
+		10000, milliseconds);
+	copies.clear();
+	c.reset(new Container(sortedItems.begin(), sortedItems.end()));
+	results[IsInList] = measure([]() {},
+		[&]() { for (int i = 0; i < walkOps; ++i) checksum += Ops::isInList(*c, sortedItems[(i * 7919u) % n]); return walkOps; },
+		10000, milliseconds);
+	// Append moves every item back and forth between two containers
+	other.reset(new Container());
+	results[Append] = measure([]() {},
+		[&]() { for (int i = 0; i < endOps; ++i) { Ops::append(*other, *c); c.swap(other); } return endOps; },
+		100000, milliseconds);
+	results[Reverse] = measure([]() {}, [&]() { Ops::reverse(*c); return n; }, 10000000, milliseconds);
+	results[Copy] = measure([&]() { other.reset(); },
+		[&]() { other.reset(new Container(*c)); return n; },
+		10000000, milliseconds);
+	results[Traverse] = measure([]() {},
+		[&]() { for (typename Container::const_iterator cur = c->begin(); cur != c->end(); ++cur) checksum += touch(*cur); return n; },
+		10000000, milliseconds);
+	c.reset();
+	other.reset();
+	// Keeps the checksum, and so the work, alive
+	sink = checksum;
+}
+// Peak resident set of the process so far, in MB
+double peakRssMb()
+{
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss / 1024.0;
+}
+// One table per size: a row per op, a column per container
+template<class ItemType>
+void benchItemType(const char* typeName, int maxSize, int milliseconds)
+{
+	const char* containerNames[4] = { "LinkedList", "forward_list", "list", "vector" };
+	for (long long size = 10; size <= maxSize; size *= 10)
+	{
+		int n = int(size);
+		XorShift rng = { 2463534242u };
+		std::vector<ItemType> items, sortedItems, probes;
+		std::vector<unsigned int> positions;
+		for (int i = 0; i < n; ++i)
+			sortedItems.push_back(makeItem<ItemType>(2 * i));
+		items = sortedItems;
+		for (int i = n - 1; i > 0; --i)
+			std::swap(items[i], items[rng.next() % (i + 1)]);
+		for (int i = 0; i < 1000; ++i)
+		{
+			probes.push_back(makeItem<ItemType>(2 * int(rng.next() % n) + 1));
+			positions.push_back(rng.next());
+		}
+		Result results[4][OpCount];
+		benchContainer<LinkedList<ItemType> >(n, items, sortedItems, probes, positions, milliseconds, results[0]);
+		benchContainer<std::forward_list<ItemType> >(n, items, sortedItems, probes, positions, milliseconds, results[1]);
+		benchContainer<std::list<ItemType> >(n, items, sortedItems, probes, positions, milliseconds, results[2]);
+		benchContainer<std::vector<ItemType> >(n, items, sortedItems, probes, positions, milliseconds, results[3]);
+		std::printf("\n%s, n = %d\tns/op (allocs/op)\n%-14s", typeName, n, "op");
+		for (int k = 0; k < 4; ++k)
+			std::printf("%-22s", containerNames[k]);
+		std::printf("\n");
+		for (int op = 0; op < OpCount; ++op)
+		{
+			std::printf("%-14s", opNames[op]);
+			for (int k = 0; k < 4; ++k)
+			{
+				char cell[32];
+				std::snprintf(cell, sizeof(cell), "%.1f (%.2f)", results[k][op].nsPerOp, results[k][op].allocsPerOp);
+				std::printf("%-22s", cell);
+			}
+			std::printf("\n");
+		}
+		std::printf("peak RSS so far: %.1f MB\n", peakRssMb());
+		std::fflush(stdout);
+	}
+}
+int main(int argc, char* argv[])
+{
+	int maxSize = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+	int milliseconds = (argc > 2) ? std::atoi(argv[2]) : 200;
+	if (maxSize < 10) maxSize = 10;
+	benchItemType<int>("int", maxSize, milliseconds);
+	benchItemType<double>("double", maxSize, milliseconds);
+	benchItemType<std::string>("string", maxSize, milliseconds);
+	return 0;
+}
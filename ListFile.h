@@ -0,0 +1,305 @@
+/*
+* ListFile.h
+* Daniel Salazar
+* 10/18/2026
+* Binary files of a LinkedList's items, for lists of trivially
+* copyable items that are too big to reprint and reparse
+* A file is a ListFileHeader followed by every item in order, as
+* one contiguous block of raw bytes
+* saveList writes a List in large buffered chunks
+* MappedList memory-maps a file and reads it in place as a read
+* only List, without copying or parsing anything
+* loadList maps a file and builds the List from it in one
+* allocation burst, reusing the List's Nodes where it can
+* Files are read on the machine that wrote them: a file from a
+* machine with another byte order or item size is rejected
+* Mapping uses POSIX mmap
+*/
+#ifndef LISTFILE_H
+#define LISTFILE_H
+#include "LinkedList.h"
+#include <climits>		// INT_MAX
+#include <cstdint>		// uint32_t, uint64_t
+#include <cstdio>		// FILE, fopen, fwrite, fclose
+#include <cstring>		// memcmp, memcpy
+#include <type_traits>	// is_trivially_copyable
+#include <fcntl.h>		// open
+#include <sys/mman.h>	// mmap, munmap, madvise
+#include <sys/stat.h>	// fstat
+#include <unistd.h>		// close
+// Start of every file, padded to 64 bytes so the items after it
+// are aligned for any ItemType
+struct ListFileHeader
+{
+	// "LLST" then format version
+	char magic[4];
+	std::uint32_t version;
+	// Reads back as 0x01020304 only in the byte order it was written in
+	std::uint32_t byteOrder;
+	// sizeof(ItemType) of the writer
+	std::uint32_t itemSize;
+	// Number of items after the header
+	std::uint64_t count;
+	char padding[40];
+	// Header for count items of itemSize bytes
+	static ListFileHeader make(std::uint32_t itemSize, std::uint64_t count);
+	// Checks a header was written by this version for itemSize bytes items
+	bool isValid(std::uint32_t itemSize) const;
+};
+inline ListFileHeader ListFileHeader::make(std::uint32_t itemSize, std::uint64_t count)
+{
+	ListFileHeader header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, "LLST", 4);
+	header.version = 1;
+	header.byteOrder = 0x01020304;
+	header.itemSize = itemSize;
+	header.count = count;
+	return header;
+}
+inline bool ListFileHeader::isValid(std::uint32_t itemSize) const
+{
+	return std::memcmp(magic, "LLST", 4) == 0 && version == 1 &&
+		byteOrder == 0x01020304 && this->itemSize == itemSize;
+}
+// Writes aList's items to path, false if the file couldn't be written
+template<class ItemType, class Allocator>
+bool saveList(const LinkedList<ItemType, Allocator>& aList, const char* path);
+// Read only List over a memory-mapped file
+// Items are read straight out of the mapping, so getEntry is O(1)
+template<class ItemType>
+class MappedList
+{
+private:
+	static_assert(std::is_trivially_copyable<ItemType>::value, "ItemType must be trivially copyable");
+	// Whole mapping, header included, nullptr if nothing is mapped
+	void* mapPtr;
+	std::size_t mapSize;
+	// First item, just past the header
+	const ItemType* items;
+	// Count of items
+	int itemCount;
+	// Not copyable, the mapping has one owner
+	MappedList(const MappedList<ItemType>& aList);
+	MappedList<ItemType>& operator=(const MappedList<ItemType>& aList);
+public:
+	typedef const ItemType* iterator;
+	typedef const ItemType* const_iterator;
+	// Nothing mapped
+	MappedList();
+	// Maps path, check isOpen
+	explicit MappedList(const char* path);
+	// Takes over aList's mapping
+	MappedList(MappedList<ItemType>&& aList) noexcept;
+	MappedList<ItemType>& operator=(MappedList<ItemType>&& aList) noexcept;
+	// Destructor, unmaps the file
+	~MappedList();
+	// Maps path, false if it can't be read or isn't a file of ItemType
+	bool open(const char* path);
+	// Unmaps the file
+	void close(void);
+	// Checks if a file is mapped
+	bool isOpen() const;
+	// Get number of items in the file
+	int getLength() const;
+	// Checks if itemCount is 0
+	bool isEmpty() const;
+	// Get a specified item by reference, O(1)
+	const ItemType& getEntry(int position) const;
+	// First and last items
+	const ItemType& front(void) const;
+	const ItemType& back(void) const;
+	// Copies the items into a new List, one allocation burst
+	template<class Allocator>
+	LinkedList<ItemType, Allocator> toList(void) const;
+	LinkedList<ItemType> toList(void) const;
+	// Iterator to the first item
+	const_iterator begin(void) const;
+	// Iterator past the last item
+	const_iterator end(void) const;
+};
+// Maps path and assigns its items to aList, false if it can't be read
+template<class ItemType, class Allocator>
+bool loadList(const char* path, LinkedList<ItemType, Allocator>& aList);
+// Header first, then the items copied into a buffer of about 1 MB
+// and written a buffer at a time
+// Fails if any write or the close fails, the file may be partial
+template<class ItemType, class Allocator>
+bool saveList(const LinkedList<ItemType, Allocator>& aList, const char* path)
+{
+	static_assert(std::is_trivially_copyable<ItemType>::value, "ItemType must be trivially copyable");
+	std::FILE* file = std::fopen(path, "wb");
+	if (file == nullptr) return false;
+	ListFileHeader header = ListFileHeader::make(sizeof(ItemType), std::uint64_t(aList.getLength()));
+	bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+	const std::size_t bufferLen = (1 << 20) / sizeof(ItemType) + 1;
+	std::vector<ItemType> buffer;
+	buffer.reserve(bufferLen);
+	for (typename LinkedList<ItemType, Allocator>::const_iterator curIter = aList.begin(); ok && curIter != aList.end(); ++curIter)
+	{
+		buffer.push_back(*curIter);
+		if (buffer.size() == bufferLen)
+		{
+			ok = std::fwrite(buffer.data(), sizeof(ItemType), buffer.size(), file) == buffer.size();
+			buffer.clear();
+		}
+	}
+	if (ok && !buffer.empty())
+		ok = std::fwrite(buffer.data(), sizeof(ItemType), buffer.size(), file) == buffer.size();
+	return (std::fclose(file) == 0) && ok;
+}
+template<class ItemType>
+MappedList<ItemType>::MappedList() : mapPtr(nullptr), mapSize(0), items(nullptr), itemCount(0)
+{
+}
+template<class ItemType>
+MappedList<ItemType>::MappedList(const char* path) : mapPtr(nullptr), mapSize(0), items(nullptr), itemCount(0)
+{
+	open(path);
+}
+template<class ItemType>
+MappedList<ItemType>::MappedList(MappedList<ItemType>&& aList) noexcept :
+	mapPtr(aList.mapPtr), mapSize(aList.mapSize), items(aList.items), itemCount(aList.itemCount)
+{
+	aList.mapPtr = nullptr;
+	aList.mapSize = 0;
+	aList.items = nullptr;
+	aList.itemCount = 0;
+}
+// Unmap thisList's file, then take over aList's
+template<class ItemType>
+MappedList<ItemType>& MappedList<ItemType>::operator=(MappedList<ItemType>&& aList) noexcept
+{
+	if (this == &aList) return *this;
+	close();
+	mapPtr = aList.mapPtr;
+	mapSize = aList.mapSize;
+	items = aList.items;
+	itemCount = aList.itemCount;
+	aList.mapPtr = nullptr;
+	aList.mapSize = 0;
+	aList.items = nullptr;
+	aList.itemCount = 0;
+	return *this;
+}
+template<class ItemType>
+MappedList<ItemType>::~MappedList()
+{
+	close();
+}
+// Drop any old mapping
+// Map the whole file read only, the descriptor isn't needed after
+// Reject it unless the header matches ItemType and the file
+// really holds count items
+// Items are read front to back far more than at random, so ask
+// the kernel to read ahead
+template<class ItemType>
+bool MappedList<ItemType>::open(const char* path)
+{
+	close();
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0) return false;
+	struct stat info;
+	if (::fstat(fd, &info) != 0 || std::uint64_t(info.st_size) < sizeof(ListFileHeader))
+	{
+		::close(fd);
+		return false;
+	}
+	std::size_t size = std::size_t(info.st_size);
+	void* ptr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (ptr == MAP_FAILED) return false;
+	const ListFileHeader* header = static_cast<const ListFileHeader*>(ptr);
+	if (!header->isValid(sizeof(ItemType)) || header->count > std::uint64_t(INT_MAX) ||
+		header->count * sizeof(ItemType) != size - sizeof(ListFileHeader))
+	{
+		::munmap(ptr, size);
+		return false;
+	}
+	::madvise(ptr, size, MADV_SEQUENTIAL);
+	mapPtr = ptr;
+	mapSize = size;
+	items = reinterpret_cast<const ItemType*>(static_cast<const char*>(ptr) + sizeof(ListFileHeader));
+	itemCount = int(header->count);
+	return true;
+}
+template<class ItemType>
+void MappedList<ItemType>::close(void)
+{
+	if (mapPtr != nullptr)
+		::munmap(mapPtr, mapSize);
+	mapPtr = nullptr;
+	mapSize = 0;
+	items = nullptr;
+	itemCount = 0;
+}
+template<class ItemType>
+inline bool MappedList<ItemType>::isOpen() const
+{
+	return mapPtr != nullptr;
+}
+template<class ItemType>
+inline int MappedList<ItemType>::getLength() const
+{
+	return itemCount;
+}
+template<class ItemType>
+inline bool MappedList<ItemType>::isEmpty() const
+{
+	return itemCount == 0;
+}
+// Up to the user to enter a legal position
+template<class ItemType>
+inline const ItemType& MappedList<ItemType>::getEntry(int position) const
+{
+	assert((position >= 1) && (position <= itemCount));
+	return items[position - 1];
+}
+// Up to the user to check the List isn't empty
+template<class ItemType>
+inline const ItemType& MappedList<ItemType>::front(void) const
+{
+	assert(itemCount > 0);
+	return items[0];
+}
+template<class ItemType>
+inline const ItemType& MappedList<ItemType>::back(void) const
+{
+	assert(itemCount > 0);
+	return items[itemCount - 1];
+}
+// Pointers are a forward range, so the List's range constructor
+// takes every Node from Allocator in one burst
+template<class ItemType>
+template<class Allocator>
+LinkedList<ItemType, Allocator> MappedList<ItemType>::toList(void) const
+{
+	return LinkedList<ItemType, Allocator>(begin(), end());
+}
+template<class ItemType>
+LinkedList<ItemType> MappedList<ItemType>::toList(void) const
+{
+	return LinkedList<ItemType>(begin(), end());
+}
+template<class ItemType>
+inline typename MappedList<ItemType>::const_iterator MappedList<ItemType>::begin(void) const
+{
+	return items;
+}
+template<class ItemType>
+inline typename MappedList<ItemType>::const_iterator MappedList<ItemType>::end(void) const
+{
+	return items + itemCount;
+}
+// aList is untouched if path can't be mapped
+// assign overwrites aList's Nodes in place and builds the rest in
+// one burst, the mapping goes away once they are copied
+template<class ItemType, class Allocator>
+bool loadList(const char* path, LinkedList<ItemType, Allocator>& aList)
+{
+	MappedList<ItemType> mapped;
+	if (!mapped.open(path)) return false;
+	aList.assign(mapped.begin(), mapped.end());
+	return true;
+}
+#endif
@@ -0,0 +1,225 @@
+/*
+* ListStats.h
+* Daniel Salazar
+* 10/18/2026
+* Opt-in counters for LinkedList and the node allocators
+* Compile with LINKEDLIST_STATS defined to turn them on; without it
+* every hook below is an empty inline function and costs nothing
+* Counters are process wide and shared by every list and thread,
+* kept as relaxed atomics
+* Read them with ListStats::snapshot(), or register a callback
+* that is handed a snapshot every period Node allocations
+* ListStatsSnapshot is one reading of the counters
+* ListStats holds the counters and the hooks that bump them
+*/
+#ifndef LISTSTATS_H
+#define LISTSTATS_H
+#ifdef LINKEDLIST_STATS
+#include <atomic>		// atomic
+#endif
+// One reading of every counter
+struct ListStatsSnapshot
+{
+	// Nodes an allocator served without going to its depot or the heap
+	long long cacheHits;
+	// Trips to the depot (SlabAllocator) or the heap (NewAllocator)
+	long long cacheMisses;
+	// Nodes LinkedLists built and destroyed
+	long long nodesAllocated;
+	long long nodesFreed;
+	// Nodes alive now, and the most ever alive at once
+	long long nodesLive;
+	long long peakNodes;
+	// Positional lookups (getNodeAt, findNodeAt) and Nodes they stepped over
+	long long lookups;
+	long long nodesWalked;
+	// List copies (copy constructor and operator=) and items they copied
+	long long listCopies;
+	long long itemsCopied;
+};
+// Counters and the hooks that bump them
+class ListStats
+{
+public:
+	// Called with a snapshot every period Node allocations
+	typedef void (*Callback)(const ListStatsSnapshot& snapshot);
+	// True when compiled with LINKEDLIST_STATS
+	static bool isEnabled(void);
+	// count Nodes came out of an allocator's cache
+	static void cacheHit(long long count);
+	// An allocator went to its depot or the heap
+	static void cacheMiss(void);
+	// count Nodes were built or destroyed
+	static void allocated(long long count);
+	static void freed(long long count);
+	// A positional lookup stepped over steps Nodes
+	static void walked(long long steps);
+	// A list copy copied count items
+	static void copied(long long count);
+	// Reads every counter, all zero when disabled
+	static ListStatsSnapshot snapshot(void);
+	// Zeroes every counter but nodesLive, peakNodes restarts from it
+	static void reset(void);
+	// Calls aCallback every period allocations, nullptr turns it off
+	static void setCallback(Callback aCallback, long long period);
+	// Calls the callback now, if one is set
+	static void report(void);
+#ifdef LINKEDLIST_STATS
+private:
+	struct Counters
+	{
+		std::atomic<long long> cacheHits, cacheMisses, nodesAllocated, nodesFreed,
+			nodesLive, peakNodes, lookups, nodesWalked, listCopies, itemsCopied;
+		std::atomic<Callback> callback;
+		std::atomic<long long> period;
+		Counters();
+	};
+	// Function local static so it is built before first use
+	static Counters& get(void);
+#endif
+};
+#ifdef LINKEDLIST_STATS
+inline ListStats::Counters::Counters() :
+	cacheHits(0), cacheMisses(0), nodesAllocated(0), nodesFreed(0), nodesLive(0), peakNodes(0),
+	lookups(0), nodesWalked(0), listCopies(0), itemsCopied(0), callback(nullptr), period(0)
+{
+}
+inline ListStats::Counters& ListStats::get(void)
+{
+	static Counters counters;
+	return counters;
+}
+inline bool ListStats::isEnabled(void)
+{
+	return true;
+}
+inline void ListStats::cacheHit(long long count)
+{
+	get().cacheHits.fetch_add(count, std::memory_order_relaxed);
+}
+inline void ListStats::cacheMiss(void)
+{
+	get().cacheMisses.fetch_add(1, std::memory_order_relaxed);
+}
+// Raise the peak if the new live count passes it
+// Call back when the total crosses a multiple of period
+inline void ListStats::allocated(long long count)
+{
+	Counters& counters = get();
+	long long live = counters.nodesLive.fetch_add(count, std::memory_order_relaxed) + count;
+	long long peak = counters.peakNodes.load(std::memory_order_relaxed);
+	while (live > peak && !counters.peakNodes.compare_exchange_weak(peak, live, std::memory_order_relaxed));
+	long long total = counters.nodesAllocated.fetch_add(count, std::memory_order_relaxed) + count;
+	long long period = counters.period.load(std::memory_order_relaxed);
+	if (period > 0 && total / period != (total - count) / period)
+		report();
+}
+inline void ListStats::freed(long long count)
+{
+	Counters& counters = get();
+	counters.nodesLive.fetch_sub(count, std::memory_order_relaxed);
+	counters.nodesFreed.fetch_add(count, std::memory_order_relaxed);
+}
+inline void ListStats::walked(long long steps)
+{
+	Counters& counters = get();
+	counters.lookups.fetch_add(1, std::memory_order_relaxed);
+	counters.nodesWalked.fetch_add(steps, std::memory_order_relaxed);
+}
+inline void ListStats::copied(long long count)
+{
+	Counters& counters = get();
+	counters.listCopies.fetch_add(1, std::memory_order_relaxed);
+	counters.itemsCopied.fetch_add(count, std::memory_order_relaxed);
+}
+// Counters are read one at a time, so a snapshot taken while other
+// threads work may be off by their last few ops
+inline ListStatsSnapshot ListStats::snapshot(void)
+{
+	Counters& counters = get();
+	ListStatsSnapshot aSnapshot;
+	aSnapshot.cacheHits = counters.cacheHits.load(std::memory_order_relaxed);
+	aSnapshot.cacheMisses = counters.cacheMisses.load(std::memory_order_relaxed);
+	aSnapshot.nodesAllocated = counters.nodesAllocated.load(std::memory_order_relaxed);
+	aSnapshot.nodesFreed = counters.nodesFreed.load(std::memory_order_relaxed);
+	aSnapshot.nodesLive = counters.nodesLive.load(std::memory_order_relaxed);
+	aSnapshot.peakNodes = counters.peakNodes.load(std::memory_order_relaxed);
+	aSnapshot.lookups = counters.lookups.load(std::memory_order_relaxed);
+	aSnapshot.nodesWalked = counters.nodesWalked.load(std::memory_order_relaxed);
+	aSnapshot.listCopies = counters.listCopies.load(std::memory_order_relaxed);
+	aSnapshot.itemsCopied = counters.itemsCopied.load(std::memory_order_relaxed);
+	return aSnapshot;
+}
+// nodesLive counts Nodes still out, so it survives a reset
+inline void ListStats::reset(void)
+{
+	Counters& counters = get();
+	counters.cacheHits.store(0, std::memory_order_relaxed);
+	counters.cacheMisses.store(0, std::memory_order_relaxed);
+	counters.nodesAllocated.store(0, std::memory_order_relaxed);
+	counters.nodesFreed.store(0, std::memory_order_relaxed);
+	counters.peakNodes.store(counters.nodesLive.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	counters.lookups.store(0, std::memory_order_relaxed);
+	counters.nodesWalked.store(0, std::memory_order_relaxed);
+	counters.listCopies.store(0, std::memory_order_relaxed);
+	counters.itemsCopied.store(0, std::memory_order_relaxed);
+}
+inline void ListStats::setCallback(Callback aCallback, long long period)
+{
+	Counters& counters = get();
+	counters.period.store(aCallback != nullptr ? period : 0, std::memory_order_relaxed);
+	counters.callback.store(aCallback, std::memory_order_release);
+}
+inline void ListStats::report(void)
+{
+	Callback aCallback = get().callback.load(std::memory_order_acquire);
+	if (aCallback != nullptr)
+		aCallback(snapshot());
+}
+#else
+// Disabled: every hook is empty and inlines away
+inline bool ListStats::isEnabled(void)
+{
+	return false;
+}
+inline void ListStats::cacheHit(long long count)
+{
+	(void)count;
+}
+inline void ListStats::cacheMiss(void)
+{
+}
+inline void ListStats::allocated(long long count)
+{
+	(void)count;
+}
+inline void ListStats::freed(long long count)
+{
+	(void)count;
+}
+inline void ListStats::walked(long long steps)
+{
+	(void)steps;
+}
+inline void ListStats::copied(long long count)
+{
+	(void)count;
+}
+inline ListStatsSnapshot ListStats::snapshot(void)
+{
+	ListStatsSnapshot aSnapshot = {};
+	return aSnapshot;
+}
+inline void ListStats::reset(void)
+{
+}
+inline void ListStats::setCallback(Callback aCallback, long long period)
+{
+	(void)aCallback;
+	(void)period;
+}
+inline void ListStats::report(void)
+{
+}
+#endif
+#endif
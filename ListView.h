@@ -0,0 +1,269 @@
+/*
+* ListView.h
+* Daniel Salazar
+* 10/18/2026
+* A non-owning view of len consecutive items of a LinkedList
+* A view is a const_iterator to its first Node and a count, so
+* making one or slicing one allocates nothing and copies nothing
+* The view reads the List's own Nodes: it is only good as long
+* as those Nodes stay in the List
+* toList copies the items into a List of their own on demand
+* ViewIterator<ItemType> walks a view, counting down to its end
+* ListView<ItemType> is the view
+*/
+#ifndef LISTVIEW_H
+#define LISTVIEW_H
+#include "LinkedList.h"
+// Forward iterator over a counted run of Nodes
+// End is the iterator with nothing left, so the Node after a
+// view's last never needs to be found
+template<class ItemType>
+class ViewIterator
+{
+private:
+	ListIterator<ItemType, const ItemType> curIter;
+	// Items left in the view, counting the current one
+	int remaining;
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef ItemType value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef const ItemType* pointer;
+	typedef const ItemType& reference;
+	// End iterator
+	ViewIterator();
+	// Points at anIter with count items left
+	ViewIterator(ListIterator<ItemType, const ItemType> anIter, int count);
+	// Current Node's item
+	reference operator*() const;
+	pointer operator->() const;
+	// Steps to the next Node, a step off the last item is end
+	ViewIterator<ItemType>& operator++();
+	ViewIterator<ItemType> operator++(int);
+	// Iterators of one view are equal when as many items are left
+	bool operator==(const ViewIterator<ItemType>& rhs) const;
+	bool operator!=(const ViewIterator<ItemType>& rhs) const;
+};
+template<class ItemType>
+inline ViewIterator<ItemType>::ViewIterator() : curIter(), remaining(0)
+{
+}
+template<class ItemType>
+inline ViewIterator<ItemType>::ViewIterator(ListIterator<ItemType, const ItemType> anIter, int count) :
+	curIter(anIter), remaining(count)
+{
+}
+template<class ItemType>
+inline typename ViewIterator<ItemType>::reference ViewIterator<ItemType>::operator*() const
+{
+	return *curIter;
+}
+template<class ItemType>
+inline typename ViewIterator<ItemType>::pointer ViewIterator<ItemType>::operator->() const
+{
+	return &*curIter;
+}
+// The last item's next is never read, it may be outside the view
+template<class ItemType>
+inline ViewIterator<ItemType>& ViewIterator<ItemType>::operator++()
+{
+	if (--remaining != 0)
+		++curIter;
+	return *this;
+}
+template<class ItemType>
+inline ViewIterator<ItemType> ViewIterator<ItemType>::operator++(int)
+{
+	ViewIterator<ItemType> prev(*this);
+	++*this;
+	return prev;
+}
+template<class ItemType>
+inline bool ViewIterator<ItemType>::operator==(const ViewIterator<ItemType>& rhs) const
+{
+	return remaining == rhs.remaining;
+}
+template<class ItemType>
+inline bool ViewIterator<ItemType>::operator!=(const ViewIterator<ItemType>& rhs) const
+{
+	return remaining != rhs.remaining;
+}
+// Read only window of len items starting at a Node of some List
+template<class ItemType>
+class ListView
+{
+private:
+	// First item of the view, unused when itemCount is 0
+	ListIterator<ItemType, const ItemType> first;
+	// Count of items in the view
+	int itemCount;
+	// Skips to the specified position of the view
+	ListIterator<ItemType, const ItemType> getIterAt(int position) const;
+public:
+	typedef ViewIterator<ItemType> iterator;
+	typedef ViewIterator<ItemType> const_iterator;
+	// Empty view
+	ListView();
+	// len items starting at anIter
+	ListView(ListIterator<ItemType, const ItemType> anIter, int len);
+	// All of aList
+	template<class Allocator>
+	ListView(const LinkedList<ItemType, Allocator>& aList);
+	// len items of aList starting at position
+	template<class Allocator>
+	ListView(const LinkedList<ItemType, Allocator>& aList, int position, int len);
+	// Get number of items in the view
+	int getLength() const;
+	// Checks if itemCount is 0
+	bool isEmpty() const;
+	// Get a specified item by reference, O(position)
+	const ItemType& getEntry(int position) const;
+	// First item, O(1)
+	const ItemType& front(void) const;
+	// len items of this view starting at position, O(position)
+	ListView<ItemType> subView(int position, int len) const;
+	// Copies the view's items into a new List, one allocation burst
+	template<class Allocator>
+	LinkedList<ItemType, Allocator> toList(void) const;
+	LinkedList<ItemType> toList(void) const;
+	// Views are equal when they hold equal items in the same order
+	bool operator==(const ListView<ItemType>& rhs) const;
+	bool operator!=(const ListView<ItemType>& rhs) const;
+	// Lexicographic order by operator<
+	bool operator<(const ListView<ItemType>& rhs) const;
+	// Iterator to the first item
+	const_iterator begin(void) const;
+	const_iterator cbegin(void) const;
+	// Iterator past the last item
+	const_iterator end(void) const;
+	const_iterator cend(void) const;
+};
+// Up to the user to enter a legal position
+// Step position - 1 Nodes from first
+template<class ItemType>
+ListIterator<ItemType, const ItemType> ListView<ItemType>::getIterAt(int position) const
+{
+	assert((position >= 1) && (position <= itemCount));
+	ListIterator<ItemType, const ItemType> curIter = first;
+	for (int skip = 1; skip < position; ++skip)
+		++curIter;
+	return curIter;
+}
+template<class ItemType>
+ListView<ItemType>::ListView() : first(), itemCount(0)
+{
+}
+template<class ItemType>
+ListView<ItemType>::ListView(ListIterator<ItemType, const ItemType> anIter, int len) :
+	first(anIter), itemCount(len)
+{
+	assert(len >= 0);
+}
+template<class ItemType>
+template<class Allocator>
+ListView<ItemType>::ListView(const LinkedList<ItemType, Allocator>& aList) :
+	first(aList.begin()), itemCount(aList.getLength())
+{
+}
+// Up to the user to enter a legal range
+// Step down aList to position
+template<class ItemType>
+template<class Allocator>
+ListView<ItemType>::ListView(const LinkedList<ItemType, Allocator>& aList, int position, int len) :
+	first(aList.begin()), itemCount(len)
+{
+	assert((position >= 1) && (len >= 0) && (position + len - 1 <= aList.getLength()));
+	for (int skip = 1; skip < position; ++skip)
+		++first;
+}
+template<class ItemType>
+inline int ListView<ItemType>::getLength() const
+{
+	return itemCount;
+}
+template<class ItemType>
+inline bool ListView<ItemType>::isEmpty() const
+{
+	return itemCount == 0;
+}
+template<class ItemType>
+const ItemType& ListView<ItemType>::getEntry(int position) const
+{
+	return *getIterAt(position);
+}
+// Up to the user to check the view isn't empty
+template<class ItemType>
+inline const ItemType& ListView<ItemType>::front(void) const
+{
+	assert(itemCount > 0);
+	return *first;
+}
+// Up to the user to enter a legal range
+// An empty slice never touches a Node
+template<class ItemType>
+ListView<ItemType> ListView<ItemType>::subView(int position, int len) const
+{
+	assert((position >= 1) && (len >= 0) && (position + len - 1 <= itemCount));
+	if (len == 0) return ListView<ItemType>();
+	return ListView<ItemType>(getIterAt(position), len);
+}
+// The view's iterators are a forward range, so the List's range
+// constructor takes every Node from Allocator in one burst
+template<class ItemType>
+template<class Allocator>
+LinkedList<ItemType, Allocator> ListView<ItemType>::toList(void) const
+{
+	return LinkedList<ItemType, Allocator>(begin(), end());
+}
+template<class ItemType>
+LinkedList<ItemType> ListView<ItemType>::toList(void) const
+{
+	return LinkedList<ItemType>(begin(), end());
+}
+// Lengths first, then item by item
+template<class ItemType>
+bool ListView<ItemType>::operator==(const ListView<ItemType>& rhs) const
+{
+	if (itemCount != rhs.itemCount) return false;
+	for (const_iterator lhsIter = begin(), rhsIter = rhs.begin(); lhsIter != end(); ++lhsIter, ++rhsIter)
+		if (!(*lhsIter == *rhsIter)) return false;
+	return true;
+}
+template<class ItemType>
+inline bool ListView<ItemType>::operator!=(const ListView<ItemType>& rhs) const
+{
+	return !(*this == rhs);
+}
+// First differing item decides, else the shorter view is less
+template<class ItemType>
+bool ListView<ItemType>::operator<(const ListView<ItemType>& rhs) const
+{
+	const_iterator lhsIter = begin(), rhsIter = rhs.begin();
+	for (; lhsIter != end() && rhsIter != rhs.end(); ++lhsIter, ++rhsIter)
+	{
+		if (*lhsIter < *rhsIter) return true;
+		if (*rhsIter < *lhsIter) return false;
+	}
+	return itemCount < rhs.itemCount;
+}
+template<class ItemType>
+inline typename ListView<ItemType>::const_iterator ListView<ItemType>::begin(void) const
+{
+	return const_iterator(first, itemCount);
+}
+template<class ItemType>
+inline typename ListView<ItemType>::const_iterator ListView<ItemType>::cbegin(void) const
+{
+	return const_iterator(first, itemCount);
+}
+template<class ItemType>
+inline typename ListView<ItemType>::const_iterator ListView<ItemType>::end(void) const
+{
+	return const_iterator();
+}
+template<class ItemType>
+inline typename ListView<ItemType>::const_iterator ListView<ItemType>::cend(void) const
+{
+	return const_iterator();
+}
+#endif
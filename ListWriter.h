@@ -0,0 +1,240 @@
+/*
+* ListWriter.h
+* Daniel Salazar
+* 10/18/2026
+* Buffered text output for printing lists and BigInts
+* A ListWriter gathers formatted items in a 64 KB buffer and hands
+* the buffer to a std::ostream or a file descriptor only when it
+* fills, so a long list costs a few large writes instead of one
+* stream call per item
+* Integers, chars and strings are formatted straight into the
+* buffer; floating point items are formatted like a default
+* std::ostream would; any other item goes through its operator<<
+* ListWriter is the writer
+*/
+#ifndef LISTWRITER_H
+#define LISTWRITER_H
+#include <cerrno>		// errno, EINTR
+#include <cstddef>		// size_t
+#include <cstdio>		// snprintf
+#include <cstring>		// strlen, memcpy
+#include <ostream>		// ostream
+#include <sstream>		// ostringstream
+#include <string>		// string
+#include <vector>		// vector
+#include <unistd.h>		// write
+class ListWriter
+{
+private:
+	// Bytes gathered before they are handed on
+	static const std::size_t BufferSize = 1 << 16;
+	std::vector<char> buffer;
+	std::size_t used;
+	// Where the bytes go, os if it isn't nullptr, else fd
+	std::ostream* os;
+	int fd;
+	// Formats items no overload below knows, reused between items
+	std::ostringstream fallback;
+	// Writes the digits of magnitude, after a '-' if negative
+	ListWriter& writeInteger(unsigned long long magnitude, bool negative);
+	// Writes value as %g with the ostream default precision
+	ListWriter& writeFloating(long double value);
+	// Not copyable, two writers would interleave one buffer's bytes
+	ListWriter(const ListWriter& aWriter);
+	ListWriter& operator=(const ListWriter& aWriter);
+public:
+	// Writes to anOs
+	explicit ListWriter(std::ostream& anOs);
+	// Writes to the open file descriptor aFd, which stays open
+	explicit ListWriter(int aFd);
+	// Destructor, flushes what is left
+	~ListWriter();
+	// Hands the buffer to the stream or descriptor, false on error
+	bool flush(void);
+	// Appends len raw bytes
+	ListWriter& write(const char* bytes, std::size_t len);
+	// Appends one char
+	ListWriter& put(char aChar);
+	// Formats an item and appends it
+	ListWriter& operator<<(char aChar);
+	ListWriter& operator<<(const char* aString);
+	ListWriter& operator<<(const std::string& aString);
+	ListWriter& operator<<(bool value);
+	ListWriter& operator<<(short value);
+	ListWriter& operator<<(unsigned short value);
+	ListWriter& operator<<(int value);
+	ListWriter& operator<<(unsigned int value);
+	ListWriter& operator<<(long value);
+	ListWriter& operator<<(unsigned long value);
+	ListWriter& operator<<(long long value);
+	ListWriter& operator<<(unsigned long long value);
+	ListWriter& operator<<(float value);
+	ListWriter& operator<<(double value);
+	ListWriter& operator<<(long double value);
+	// Any other item, through its std::ostream operator<<
+	template<class ItemType>
+	ListWriter& operator<<(const ItemType& anItem);
+};
+inline ListWriter::ListWriter(std::ostream& anOs) : buffer(BufferSize), used(0), os(&anOs), fd(-1)
+{
+}
+inline ListWriter::ListWriter(int aFd) : buffer(BufferSize), used(0), os(nullptr), fd(aFd)
+{
+}
+inline ListWriter::~ListWriter()
+{
+	flush();
+}
+// One ostream write for the whole buffer
+// A descriptor may take fewer bytes than asked, so keep writing
+// the rest, retrying writes cut short by a signal
+inline bool ListWriter::flush(void)
+{
+	std::size_t done = 0;
+	bool ok = true;
+	if (os != nullptr)
+	{
+		os->write(buffer.data(), std::streamsize(used));
+		ok = !os->fail();
+	}
+	else
+		while (done < used)
+		{
+			ssize_t written = ::write(fd, buffer.data() + done, used - done);
+			if (written < 0 && errno == EINTR) continue;
+			if (written <= 0)
+			{
+				ok = false;
+				break;
+			}
+			done += std::size_t(written);
+		}
+	used = 0;
+	return ok;
+}
+// Copy into the buffer, flushing each time it fills
+// A write bigger than the whole buffer is handed on directly
+inline ListWriter& ListWriter::write(const char* bytes, std::size_t len)
+{
+	if (len > BufferSize - used)
+	{
+		flush();
+		if (len >= BufferSize)
+		{
+			if (os != nullptr)
+				os->write(bytes, std::streamsize(len));
+			else
+				for (std::size_t done = 0; done < len; )
+				{
+					ssize_t written = ::write(fd, bytes + done, len - done);
+					if (written < 0 && errno == EINTR) continue;
+					if (written <= 0) break;
+					done += std::size_t(written);
+				}
+			return *this;
+		}
+	}
+	std::memcpy(buffer.data() + used, bytes, len);
+	used += len;
+	return *this;
+}
+inline ListWriter& ListWriter::put(char aChar)
+{
+	if (used == BufferSize)
+		flush();
+	buffer[used++] = aChar;
+	return *this;
+}
+// Fill a small array with digits from the right, then copy it in
+inline ListWriter& ListWriter::writeInteger(unsigned long long magnitude, bool negative)
+{
+	char digits[24];
+	int first = sizeof(digits);
+	do
+	{
+		digits[--first] = char('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude != 0);
+	if (negative)
+		digits[--first] = '-';
+	return write(digits + first, sizeof(digits) - first);
+}
+inline ListWriter& ListWriter::writeFloating(long double value)
+{
+	char digits[64];
+	int len = std::snprintf(digits, sizeof(digits), "%.6Lg", value);
+	return write(digits, std::size_t(len));
+}
+inline ListWriter& ListWriter::operator<<(char aChar)
+{
+	return put(aChar);
+}
+inline ListWriter& ListWriter::operator<<(const char* aString)
+{
+	return write(aString, std::strlen(aString));
+}
+inline ListWriter& ListWriter::operator<<(const std::string& aString)
+{
+	return write(aString.data(), aString.size());
+}
+inline ListWriter& ListWriter::operator<<(bool value)
+{
+	return put(value ? '1' : '0');
+}
+inline ListWriter& ListWriter::operator<<(short value)
+{
+	return *this << (long long)value;
+}
+inline ListWriter& ListWriter::operator<<(unsigned short value)
+{
+	return writeInteger(value, false);
+}
+inline ListWriter& ListWriter::operator<<(int value)
+{
+	return *this << (long long)value;
+}
+inline ListWriter& ListWriter::operator<<(unsigned int value)
+{
+	return writeInteger(value, false);
+}
+inline ListWriter& ListWriter::operator<<(long value)
+{
+	return *this << (long long)value;
+}
+inline ListWriter& ListWriter::operator<<(unsigned long value)
+{
+	return writeInteger(value, false);
+}
+// Negate in unsigned so the most negative value doesn't overflow
+inline ListWriter& ListWriter::operator<<(long long value)
+{
+	if (value < 0)
+		return writeInteger(0ULL - (unsigned long long)value, true);
+	return writeInteger((unsigned long long)value, false);
+}
+inline ListWriter& ListWriter::operator<<(unsigned long long value)
+{
+	return writeInteger(value, false);
+}
+inline ListWriter& ListWriter::operator<<(float value)
+{
+	return writeFloating(value);
+}
+inline ListWriter& ListWriter::operator<<(double value)
+{
+	return writeFloating(value);
+}
+inline ListWriter& ListWriter::operator<<(long double value)
+{
+	return writeFloating(value);
+}
+// Empty the reused stream, format anItem into it and copy it in
+template<class ItemType>
+ListWriter& ListWriter::operator<<(const ItemType& anItem)
+{
+	fallback.str(std::string());
+	fallback.clear();
+	fallback << anItem;
+	return *this << fallback.str();
+}
+#endif
@@ -0,0 +1,500 @@
+/*
+* NodeAllocator.h
+* Daniel Salazar
+* 10/18/2026
+* Allocator policies for LinkedList<ItemType, Allocator>
+* A policy hands out raw storage for one NodeType at a time,
+* or a chain of them in one burst for bulk loads,
+* and takes it back once the Node has been destroyed, one at a
+* time or as a chain from a bulk removal
+* NewAllocator<NodeType> asks the heap for every Node
+* SlabAllocator<NodeType> carves Nodes out of large slabs
+* and caches them per thread
+* With LINKEDLIST_STATS both report cache hits and misses to
+* ListStats (ListStats.h)
+*/
+#ifndef NODEALLOCATOR_H
+#define NODEALLOCATOR_H
+#include <mutex>		// mutex, lock_guard, unique_lock
+#include <new>			// operator new, operator delete
+#include "ListStats.h"
+// Plain heap policy: one new/delete per Node
+template<class NodeType>
+class NewAllocator
+{
+public:
+	// Returns uninitialized storage for one Node
+	static NodeType* allocate(void);
+	// Returns count Nodes' storage chained through chainNext
+	static NodeType* allocateChain(int count);
+	// Next storage in a chain, read it before building a Node there
+	static NodeType* chainNext(NodeType* curPtr);
+	// Links destroyed storage in front of nextPtr to build a chain
+	static void setChainNext(NodeType* curPtr, NodeType* nextPtr);
+	// Returns a destroyed Node's storage to the heap
+	static void deallocate(NodeType* curPtr);
+	// Returns a chain of count destroyed Nodes, first to last,
+	// built with setChainNext
+	static void deallocateChain(NodeType* first, NodeType* last, int count);
+	// Nothing is cached, so nothing to release
+	static bool release(void);
+};
+// Gets storage straight from the heap, every Node is a miss
+template<class NodeType>
+inline NodeType* NewAllocator<NodeType>::allocate(void)
+{
+	ListStats::cacheMiss();
+	return static_cast<NodeType*>(::operator new(sizeof(NodeType)));
+}
+// One heap request per Node, each one's storage holds
+// a ptr to the next until a Node is built in it
+template<class NodeType>
+NodeType* NewAllocator<NodeType>::allocateChain(int count)
+{
+	static_assert(sizeof(NodeType) >= sizeof(NodeType*), "Node too small to chain");
+	NodeType* chain = nullptr;
+	for (; count > 0; --count)
+	{
+		NodeType* curPtr = allocate();
+		*reinterpret_cast<NodeType**>(curPtr) = chain;
+		chain = curPtr;
+	}
+	return chain;
+}
+template<class NodeType>
+inline NodeType* NewAllocator<NodeType>::chainNext(NodeType* curPtr)
+{
+	return *reinterpret_cast<NodeType**>(curPtr);
+}
+// Gives storage straight back to the heap
+template<class NodeType>
+inline void NewAllocator<NodeType>::deallocate(NodeType* curPtr)
+{
+	::operator delete(curPtr);
+}
+template<class NodeType>
+inline void NewAllocator<NodeType>::setChainNext(NodeType* curPtr, NodeType* nextPtr)
+{
+	*reinterpret_cast<NodeType**>(curPtr) = nextPtr;
+}
+// Still one delete per Node, the heap has no batch free
+template<class NodeType>
+void NewAllocator<NodeType>::deallocateChain(NodeType* first, NodeType* last, int count)
+{
+	(void)last;
+	for (; count > 0; --count)
+	{
+		NodeType* nextPtr = chainNext(first);
+		deallocate(first);
+		first = nextPtr;
+	}
+}
+// Always succeeds, there are no slabs to free
+template<class NodeType>
+inline bool NewAllocator<NodeType>::release(void)
+{
+	return true;
+}
+// Slab policy: Nodes are carved out of contiguous slabs of
+// SlabSize Nodes and recycled without going back to the heap.
+// Every thread keeps its own cache of free Nodes, so allocate and
+// deallocate never lock. Caches trade Nodes with a shared depot
+// BatchSize at a time, which is the only place a lock is taken.
+// Memory only goes back to the heap a whole slab at a time.
+// Every list with the same NodeType shares one pool, so Nodes
+// may be relinked from one list into another, even across threads.
+template<class NodeType, int SlabSize = 1024, int BatchSize = 64>
+class SlabAllocator
+{
+private:
+	// Storage for one Node, or links while it sits in a cache or the depot
+	union Block
+	{
+		struct
+		{
+			// Next free Block
+			Block* next;
+			// Next full batch in the depot
+			Block* nextBatch;
+		} link;
+		alignas(NodeType) unsigned char storage[sizeof(NodeType)];
+	};
+	// A contiguous run of Blocks
+	struct Slab
+	{
+		Slab* next;
+		Block blocks[SlabSize];
+	};
+	// Shared by every thread, guarded by lock
+	struct Depot
+	{
+		std::mutex lock;
+		// Every Slab allocated so far
+		Slab* slabs;
+		// Chains of exactly BatchSize Blocks
+		Block* batches;
+		// Leftover Blocks flushed by exiting threads
+		Block* loose;
+		int looseCount;
+		// Next never used Block in the newest Slab
+		Block* fresh;
+		// One past the last Block of the newest Slab
+		Block* freshEnd;
+		// Blocks carved out of slabs so far
+		long carved;
+		// Blocks sitting in batches or loose
+		long stored;
+		Depot();
+	};
+	// Free Blocks owned by one thread
+	// Trivially destructible, so it can still be read after the
+	// thread's closer has run
+	struct Cache
+	{
+		Block* free;
+		int count;
+		// Set once the thread exits, every later Block goes
+		// straight back to the depot
+		bool closed;
+	};
+	// Hands the cache back to the depot when the thread exits
+	struct Closer
+	{
+		// Called on every cache access, so the closer is built
+		// (and its destructor registered) in every thread that uses it
+		void open(void) {}
+		~Closer();
+	};
+	static thread_local Cache cache;
+	static thread_local Closer closer;
+	// This thread's cache, making sure its closer is registered
+	static Cache& getCache(void);
+	// The depot is built on first use and never destroyed
+	static Depot& getDepot(void);
+	// Moves one batch from the depot into aCache
+	static void refill(Cache& aCache);
+	// Same as refill, caller holds the depot lock
+	static void refillLocked(Depot& depot, Cache& aCache);
+	// Moves count Blocks from aCache into the depot
+	static void flush(Cache& aCache, int count);
+	// Frees every slab, caller holds the depot lock
+	static void freeSlabs(Depot& depot);
+public:
+	// Returns uninitialized storage for one Node
+	static NodeType* allocate(void);
+	// Returns count Nodes' storage chained through chainNext,
+	// taking the depot lock at most once
+	static NodeType* allocateChain(int count);
+	// Next storage in a chain, read it before building a Node there
+	static NodeType* chainNext(NodeType* curPtr);
+	// Links destroyed storage in front of nextPtr to build a chain
+	static void setChainNext(NodeType* curPtr, NodeType* nextPtr);
+	// Recycles a destroyed Node's storage
+	static void deallocate(NodeType* curPtr);
+	// Recycles a chain of count destroyed Nodes, first to last,
+	// built with setChainNext, taking the depot lock at most once
+	static void deallocateChain(NodeType* first, NodeType* last, int count);
+	// Flushes this thread's cache and frees every slab at once
+	// if no Node is live or held by another thread's cache
+	// Returns false if Nodes are still out
+	static bool release(void);
+	// Number of Nodes not back in the depot or this thread's cache
+	static long getLive(void);
+};
+// Each thread's cache starts out empty and open
+template<class NodeType, int SlabSize, int BatchSize>
+thread_local typename SlabAllocator<NodeType, SlabSize, BatchSize>::Cache
+	SlabAllocator<NodeType, SlabSize, BatchSize>::cache;
+template<class NodeType, int SlabSize, int BatchSize>
+thread_local typename SlabAllocator<NodeType, SlabSize, BatchSize>::Closer
+	SlabAllocator<NodeType, SlabSize, BatchSize>::closer;
+// Nothing carved yet
+template<class NodeType, int SlabSize, int BatchSize>
+SlabAllocator<NodeType, SlabSize, BatchSize>::Depot::Depot() :
+	slabs(nullptr), batches(nullptr), loose(nullptr), looseCount(0),
+	fresh(nullptr), freshEnd(nullptr), carved(0), stored(0)
+{
+}
+// Return everything this thread still holds and close the cache
+// Lists destroyed later in this thread (thread_local lists, or
+// namespace scope lists in the main thread) free past the cache
+template<class NodeType, int SlabSize, int BatchSize>
+SlabAllocator<NodeType, SlabSize, BatchSize>::Closer::~Closer()
+{
+	Cache& aCache = cache;
+	if (aCache.count != 0)
+		flush(aCache, aCache.count);
+	aCache.closed = true;
+}
+// Touch the closer before handing out the cache
+template<class NodeType, int SlabSize, int BatchSize>
+inline typename SlabAllocator<NodeType, SlabSize, BatchSize>::Cache&
+	SlabAllocator<NodeType, SlabSize, BatchSize>::getCache(void)
+{
+	closer.open();
+	return cache;
+}
+// Built on the heap and never deleted, so lists destroyed at exit,
+// in any order with other statics, still have a depot to free into
+// Its slabs are left for the OS to reclaim
+template<class NodeType, int SlabSize, int BatchSize>
+typename SlabAllocator<NodeType, SlabSize, BatchSize>::Depot&
+	SlabAllocator<NodeType, SlabSize, BatchSize>::getDepot(void)
+{
+	static Depot* depot = new Depot;
+	return *depot;
+}
+// Lock the depot and refill
+template<class NodeType, int SlabSize, int BatchSize>
+void SlabAllocator<NodeType, SlabSize, BatchSize>::refill(Cache& aCache)
+{
+	Depot& depot = getDepot();
+	std::lock_guard<std::mutex> guard(depot.lock);
+	refillLocked(depot, aCache);
+}
+// If the depot has a full batch, unlink that batch
+// Else if it has loose Blocks, take up to BatchSize of them
+// Else carve BatchSize Blocks in address order from the newest
+// Slab, allocating a new Slab when it is used up
+template<class NodeType, int SlabSize, int BatchSize>
+void SlabAllocator<NodeType, SlabSize, BatchSize>::refillLocked(Depot& depot, Cache& aCache)
+{
+	Block *head, *tail;
+	int count = 0;
+	if (depot.batches != nullptr)
+	{
+		head = depot.batches;
+		depot.batches = head->link.nextBatch;
+		count = BatchSize;
+		for (tail = head; tail->link.next != nullptr; tail = tail->link.next);
+	}
+	else if (depot.loose != nullptr)
+	{
+		head = tail = depot.loose;
+		for (count = 1; count < BatchSize && tail->link.next != nullptr; ++count)
+			tail = tail->link.next;
+		depot.loose = tail->link.next;
+		depot.looseCount -= count;
+	}
+	else
+	{
+		if (depot.fresh == depot.freshEnd)
+		{
+			Slab* newSlab = static_cast<Slab*>(::operator new(sizeof(Slab)));
+			newSlab->next = depot.slabs;
+			depot.slabs = newSlab;
+			depot.fresh = newSlab->blocks;
+			depot.freshEnd = newSlab->blocks + SlabSize;
+		}
+		head = tail = depot.fresh++;
+		for (count = 1; count < BatchSize && depot.fresh != depot.freshEnd; ++count)
+		{
+			tail->link.next = depot.fresh;
+			tail = depot.fresh++;
+		}
+		depot.carved += count;
+		depot.stored += count;
+	}
+	depot.stored -= count;
+	tail->link.next = aCache.free;
+	aCache.free = head;
+	aCache.count += count;
+}
+// Unlink the first count Blocks from aCache
+// A full batch goes on the depot's batch stack,
+// anything smaller joins the loose Blocks
+template<class NodeType, int SlabSize, int BatchSize>
+void SlabAllocator<NodeType, SlabSize, BatchSize>::flush(Cache& aCache, int count)
+{
+	Block *head = aCache.free, *tail = head;
+	for (int i = 1; i < count; ++i)
+		tail = tail->link.next;
+	aCache.free = tail->link.next;
+	aCache.count -= count;
+	Depot& depot = getDepot();
+	std::lock_guard<std::mutex> guard(depot.lock);
+	if (count == BatchSize)
+	{
+		tail->link.next = nullptr;
+		head->link.nextBatch = depot.batches;
+		depot.batches = head;
+	}
+	else
+	{
+		tail->link.next = depot.loose;
+		depot.loose = head;
+		depot.looseCount += count;
+	}
+	depot.stored += count;
+}
+// Delete every Slab in one sweep and forget the free Blocks
+template<class NodeType, int SlabSize, int BatchSize>
+void SlabAllocator<NodeType, SlabSize, BatchSize>::freeSlabs(Depot& depot)
+{
+	Slab* curPtr = depot.slabs, *prevPtr;
+	while (curPtr != nullptr)
+	{
+		prevPtr = curPtr;
+		curPtr = curPtr->next;
+		::operator delete(prevPtr);
+	}
+	depot.slabs = nullptr;
+	depot.batches = depot.loose = nullptr;
+	depot.looseCount = 0;
+	depot.fresh = depot.freshEnd = nullptr;
+	depot.carved = depot.stored = 0;
+}
+// Pop a Block off this thread's cache, refilling it when empty
+// A closed cache gives the rest of the refill straight back
+template<class NodeType, int SlabSize, int BatchSize>
+inline NodeType* SlabAllocator<NodeType, SlabSize, BatchSize>::allocate(void)
+{
+	Cache& aCache = getCache();
+	if (aCache.free == nullptr)
+	{
+		ListStats::cacheMiss();
+		refill(aCache);
+	}
+	else
+		ListStats::cacheHit(1);
+	Block* curPtr = aCache.free;
+	aCache.free = curPtr->link.next;
+	--aCache.count;
+	if (aCache.closed && aCache.count != 0)
+		flush(aCache, aCache.count);
+	return reinterpret_cast<NodeType*>(curPtr->storage);
+}
+// Take what this thread's cache holds first
+// If that isn't enough, lock the depot once and keep refilling
+// the cache from it until count Blocks are chained
+// Whatever is left of the last batch stays in the cache
+// Every refill is a miss, every other Block a hit
+// A closed cache gives the leftovers back after unlocking
+template<class NodeType, int SlabSize, int BatchSize>
+NodeType* SlabAllocator<NodeType, SlabSize, BatchSize>::allocateChain(int count)
+{
+	Cache& aCache = getCache();
+	Block *head = nullptr, *tail = nullptr;
+	std::unique_lock<std::mutex> guard;
+	int requested = count, refills = 0;
+	for (; count > 0; --count)
+	{
+		if (aCache.free == nullptr)
+		{
+			Depot& depot = getDepot();
+			if (!guard.owns_lock())
+				guard = std::unique_lock<std::mutex>(depot.lock);
+			refillLocked(depot, aCache);
+			ListStats::cacheMiss();
+			++refills;
+		}
+		Block* curPtr = aCache.free;
+		aCache.free = curPtr->link.next;
+		--aCache.count;
+		if (tail == nullptr)
+			head = curPtr;
+		else
+			tail->link.next = curPtr;
+		tail = curPtr;
+	}
+	if (tail != nullptr)
+		tail->link.next = nullptr;
+	if (aCache.closed && aCache.count != 0)
+	{
+		if (guard.owns_lock())
+			guard.unlock();
+		flush(aCache, aCache.count);
+	}
+	ListStats::cacheHit(requested - refills);
+	return reinterpret_cast<NodeType*>(head);
+}
+// Free Blocks are linked through link.next, which a chain keeps
+template<class NodeType, int SlabSize, int BatchSize>
+inline NodeType* SlabAllocator<NodeType, SlabSize, BatchSize>::chainNext(NodeType* curPtr)
+{
+	return reinterpret_cast<NodeType*>(reinterpret_cast<Block*>(curPtr)->link.next);
+}
+// Push the Block onto this thread's cache
+// Hand a batch to the depot once the cache holds two
+// A closed cache hands everything over at once
+template<class NodeType, int SlabSize, int BatchSize>
+inline void SlabAllocator<NodeType, SlabSize, BatchSize>::deallocate(NodeType* curPtr)
+{
+	Cache& aCache = getCache();
+	Block* block = reinterpret_cast<Block*>(curPtr);
+	block->link.next = aCache.free;
+	aCache.free = block;
+	if (++aCache.count >= 2 * BatchSize)
+		flush(aCache, BatchSize);
+	else if (aCache.closed)
+		flush(aCache, aCache.count);
+}
+template<class NodeType, int SlabSize, int BatchSize>
+inline void SlabAllocator<NodeType, SlabSize, BatchSize>::setChainNext(NodeType* curPtr, NodeType* nextPtr)
+{
+	reinterpret_cast<Block*>(curPtr)->link.next = reinterpret_cast<Block*>(nextPtr);
+}
+// Push the whole chain onto this thread's cache
+// Like deallocate, once the cache holds two batches cut full
+// batches off it, leaving between one and two batches, then
+// lock the depot once to push them all
+// A closed cache hands the whole chain over as loose Blocks
+template<class NodeType, int SlabSize, int BatchSize>
+void SlabAllocator<NodeType, SlabSize, BatchSize>::deallocateChain(NodeType* first, NodeType* last, int count)
+{
+	if (count == 0) return;
+	Cache& aCache = getCache();
+	reinterpret_cast<Block*>(last)->link.next = aCache.free;
+	aCache.free = reinterpret_cast<Block*>(first);
+	aCache.count += count;
+	if (aCache.closed)
+	{
+		flush(aCache, aCache.count);
+		return;
+	}
+	if (aCache.count < 2 * BatchSize) return;
+	Block *batches = nullptr, *lastBatch = nullptr;
+	int moved = 0;
+	while (aCache.count >= 2 * BatchSize)
+	{
+		Block *head = aCache.free, *tail = head;
+		for (int i = 1; i < BatchSize; ++i)
+			tail = tail->link.next;
+		aCache.free = tail->link.next;
+		aCache.count -= BatchSize;
+		tail->link.next = nullptr;
+		head->link.nextBatch = batches;
+		if (lastBatch == nullptr)
+			lastBatch = head;
+		batches = head;
+		moved += BatchSize;
+	}
+	Depot& depot = getDepot();
+	std::lock_guard<std::mutex> guard(depot.lock);
+	lastBatch->link.nextBatch = depot.batches;
+	depot.batches = batches;
+	depot.stored += moved;
+}
+// Flush this thread's cache
+// If the depot holds every Block ever carved, free the slabs
+template<class NodeType, int SlabSize, int BatchSize>
+bool SlabAllocator<NodeType, SlabSize, BatchSize>::release(void)
+{
+	Cache& aCache = getCache();
+	if (aCache.count != 0)
+		flush(aCache, aCache.count);
+	Depot& depot = getDepot();
+	std::lock_guard<std::mutex> guard(depot.lock);
+	if (depot.stored != depot.carved) return false;
+	freeSlabs(depot);
+	return true;
+}
+// Carved minus what the depot and this thread's cache hold
+template<class NodeType, int SlabSize, int BatchSize>
+long SlabAllocator<NodeType, SlabSize, BatchSize>::getLive(void)
+{
+	Depot& depot = getDepot();
+	std::lock_guard<std::mutex> guard(depot.lock);
+	return depot.carved - depot.stored - getCache().count;
+}
+#endif
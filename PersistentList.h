@@ -0,0 +1,363 @@
+/*
+* PersistentList.h
+* Daniel Salazar
+* 10/18/2026
+* An immutable singly linked list whose versions share their tails
+* push and pop return a new version in O(1) and leave the old one
+* untouched, and copying a version is O(1): only the count on its
+* first Node goes up
+* Each Node counts the versions and Nodes pointing at it, and goes
+* back to Allocator when the last of them lets go
+* Counts are atomic, so versions may be shared across threads
+* PersistentNode<ItemType> is the List Element
+* PersistentList<ItemType, Allocator> is one version of the List
+*/
+#ifndef PERSISTENTLIST_H
+#define PERSISTENTLIST_H
+#include "NodeAllocator.h"
+#include <atomic>		// atomic
+#include <cassert>		// assert
+#include <cstddef>		// ptrdiff_t
+#include <iostream>		// cout
+#include <iterator>		// forward_iterator_tag
+#include <new>			// placement new
+#include <utility>		// forward, move
+// A shared, never modified Node
+template<class ItemType>
+class PersistentNode
+{
+private:
+	ItemType item;
+	PersistentNode<ItemType>* next;
+	// Versions and Nodes pointing at this Node
+	std::atomic<int> refCount;
+public:
+	// Builds item in place from args in front of nextNodePtr
+	// Takes over one reference to nextNodePtr
+	template<class... Args>
+	PersistentNode(PersistentNode<ItemType>* nextNodePtr, Args&&... args);
+	// Get Node's Item
+	const ItemType& getItem() const;
+	// Get Node's nextPtr
+	PersistentNode<ItemType>* getNext() const;
+	// One more version or Node points at this Node
+	void addRef();
+	// One less, true if that was the last
+	bool dropRef();
+};
+template<class ItemType>
+template<class... Args>
+PersistentNode<ItemType>::PersistentNode(PersistentNode<ItemType>* nextNodePtr, Args&&... args) :
+	item(std::forward<Args>(args)...), next(nextNodePtr), refCount(1)
+{
+}
+template<class ItemType>
+inline const ItemType& PersistentNode<ItemType>::getItem() const
+{
+	return item;
+}
+template<class ItemType>
+inline PersistentNode<ItemType>* PersistentNode<ItemType>::getNext() const
+{
+	return next;
+}
+// Nothing is read through the new reference yet, relaxed is enough
+template<class ItemType>
+inline void PersistentNode<ItemType>::addRef()
+{
+	refCount.fetch_add(1, std::memory_order_relaxed);
+}
+// The last drop must see every other thread's reads of the Node done
+template<class ItemType>
+inline bool PersistentNode<ItemType>::dropRef()
+{
+	return refCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+// Forward iterator over a version's Nodes, items are read only
+template<class ItemType>
+class PersistentIterator
+{
+private:
+	const PersistentNode<ItemType>* curPtr;
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef ItemType value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef const ItemType* pointer;
+	typedef const ItemType& reference;
+	// Points at nodePtr (nullptr is end)
+	explicit PersistentIterator(const PersistentNode<ItemType>* nodePtr = nullptr);
+	// Current Node's item
+	reference operator*() const;
+	pointer operator->() const;
+	// Steps to the next Node
+	PersistentIterator<ItemType>& operator++();
+	PersistentIterator<ItemType> operator++(int);
+	// Iterators are equal when they point at the same Node
+	bool operator==(const PersistentIterator<ItemType>& rhs) const;
+	bool operator!=(const PersistentIterator<ItemType>& rhs) const;
+};
+template<class ItemType>
+inline PersistentIterator<ItemType>::PersistentIterator(const PersistentNode<ItemType>* nodePtr) :
+	curPtr(nodePtr)
+{
+}
+template<class ItemType>
+inline typename PersistentIterator<ItemType>::reference PersistentIterator<ItemType>::operator*() const
+{
+	return curPtr->getItem();
+}
+template<class ItemType>
+inline typename PersistentIterator<ItemType>::pointer PersistentIterator<ItemType>::operator->() const
+{
+	return &curPtr->getItem();
+}
+template<class ItemType>
+inline PersistentIterator<ItemType>& PersistentIterator<ItemType>::operator++()
+{
+	curPtr = curPtr->getNext();
+	return *this;
+}
+template<class ItemType>
+inline PersistentIterator<ItemType> PersistentIterator<ItemType>::operator++(int)
+{
+	PersistentIterator<ItemType> prev(*this);
+	curPtr = curPtr->getNext();
+	return prev;
+}
+template<class ItemType>
+inline bool PersistentIterator<ItemType>::operator==(const PersistentIterator<ItemType>& rhs) const
+{
+	return curPtr == rhs.curPtr;
+}
+template<class ItemType>
+inline bool PersistentIterator<ItemType>::operator!=(const PersistentIterator<ItemType>& rhs) const
+{
+	return curPtr != rhs.curPtr;
+}
+// One version of a persistent List
+// Nothing reachable from a version ever changes, so any number of
+// versions may share Nodes
+template<class ItemType, class Allocator = SlabAllocator<PersistentNode<ItemType> > >
+class PersistentList
+{
+private:
+	// Points to nullptr/First Node, holds one reference to it
+	PersistentNode<ItemType>* headPtr;
+	// Count of Nodes reachable from headPtr
+	int itemCount;
+	// Takes over a reference to nodePtr, a List of len items
+	PersistentList(PersistentNode<ItemType>* nodePtr, int len);
+	// Drops a reference to curPtr, freeing every Node left unreferenced
+	static void release(PersistentNode<ItemType>* curPtr);
+public:
+	// Policy Nodes are allocated with
+	typedef Allocator allocator_type;
+	typedef PersistentIterator<ItemType> iterator;
+	typedef PersistentIterator<ItemType> const_iterator;
+	// Default constructor
+	PersistentList();
+	// Shares aList's Nodes, O(1)
+	PersistentList(const PersistentList<ItemType, Allocator>& aList);
+	// Takes over aList's Nodes, aList is left empty
+	PersistentList(PersistentList<ItemType, Allocator>&& aList) noexcept;
+	// Shares aList's Nodes, O(1)
+	PersistentList<ItemType, Allocator>& operator=(const PersistentList<ItemType, Allocator>& aList);
+	// Takes over aList's Nodes, aList is left empty
+	PersistentList<ItemType, Allocator>& operator=(PersistentList<ItemType, Allocator>&& aList) noexcept;
+	// Destructor
+	~PersistentList();
+	// New version with newEntry in front of this one, O(1)
+	PersistentList<ItemType, Allocator> push(const ItemType& newEntry) const;
+	PersistentList<ItemType, Allocator> push(ItemType&& newEntry) const;
+	// New version with an item built in place from args in front, O(1)
+	template<class... Args>
+	PersistentList<ItemType, Allocator> emplace_front(Args&&... args) const;
+	// New version without the first item, O(1)
+	PersistentList<ItemType, Allocator> pop() const;
+	// Up to the user to check the List isn't empty
+	// First item, O(1)
+	const ItemType& front(void) const;
+	// Get a specified Node's item, O(position)
+	const ItemType& getEntry(int position) const;
+	// Get number of Nodes in this version
+	int getLength() const;
+	// Checks if itemCount is 0
+	bool isEmpty() const;
+	// Sequential search for item
+	bool isInList(const ItemType& anEntry) const;
+	// Displays all Node's item to stdout
+	void printList(void) const;
+	// Iterator to the first item
+	const_iterator begin(void) const;
+	const_iterator cbegin(void) const;
+	// Iterator past the last item
+	const_iterator end(void) const;
+	const_iterator cend(void) const;
+};
+template<class ItemType, class Allocator>
+inline PersistentList<ItemType, Allocator>::PersistentList(PersistentNode<ItemType>* nodePtr, int len) :
+	headPtr(nodePtr), itemCount(len)
+{
+}
+// Drop the reference, if that was the last one the Node goes
+// back to Allocator and its reference to next is dropped in turn
+// A loop, not recursion, so a long unshared List can't blow the stack
+template<class ItemType, class Allocator>
+void PersistentList<ItemType, Allocator>::release(PersistentNode<ItemType>* curPtr)
+{
+	while (curPtr != nullptr && curPtr->dropRef())
+	{
+		PersistentNode<ItemType>* nextPtr = curPtr->getNext();
+		curPtr->~PersistentNode<ItemType>();
+		Allocator::deallocate(curPtr);
+		curPtr = nextPtr;
+	}
+}
+template<class ItemType, class Allocator>
+PersistentList<ItemType, Allocator>::PersistentList() : headPtr(nullptr), itemCount(0)
+{
+}
+template<class ItemType, class Allocator>
+PersistentList<ItemType, Allocator>::PersistentList(const PersistentList<ItemType, Allocator>& aList) :
+	headPtr(aList.headPtr), itemCount(aList.itemCount)
+{
+	if (headPtr != nullptr)
+		headPtr->addRef();
+}
+template<class ItemType, class Allocator>
+PersistentList<ItemType, Allocator>::PersistentList(PersistentList<ItemType, Allocator>&& aList) noexcept :
+	headPtr(aList.headPtr), itemCount(aList.itemCount)
+{
+	aList.headPtr = nullptr;
+	aList.itemCount = 0;
+}
+// Take the new reference before dropping the old,
+// so self assignment is harmless
+template<class ItemType, class Allocator>
+PersistentList<ItemType, Allocator>& PersistentList<ItemType, Allocator>::operator=(const PersistentList<ItemType, Allocator>& aList)
+{
+	if (aList.headPtr != nullptr)
+		aList.headPtr->addRef();
+	release(headPtr);
+	headPtr = aList.headPtr;
+	itemCount = aList.itemCount;
+	return *this;
+}
+template<class ItemType, class Allocator>
+PersistentList<ItemType, Allocator>& PersistentList<ItemType, Allocator>::operator=(PersistentList<ItemType, Allocator>&& aList) noexcept
+{
+	if (this == &aList) return *this;
+	release(headPtr);
+	headPtr = aList.headPtr;
+	itemCount = aList.itemCount;
+	aList.headPtr = nullptr;
+	aList.itemCount = 0;
+	return *this;
+}
+template<class ItemType, class Allocator>
+PersistentList<ItemType, Allocator>::~PersistentList()
+{
+	release(headPtr);
+}
+template<class ItemType, class Allocator>
+inline PersistentList<ItemType, Allocator> PersistentList<ItemType, Allocator>::push(const ItemType& newEntry) const
+{
+	return emplace_front(newEntry);
+}
+template<class ItemType, class Allocator>
+inline PersistentList<ItemType, Allocator> PersistentList<ItemType, Allocator>::push(ItemType&& newEntry) const
+{
+	return emplace_front(std::move(newEntry));
+}
+// The new Node points at this version's first Node,
+// which gains a reference once the Node is built
+// If the item throws, give the storage back and rethrow
+template<class ItemType, class Allocator>
+template<class... Args>
+PersistentList<ItemType, Allocator> PersistentList<ItemType, Allocator>::emplace_front(Args&&... args) const
+{
+	PersistentNode<ItemType>* newNode = Allocator::allocate();
+	try
+	{
+		new (newNode) PersistentNode<ItemType>(headPtr, std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		Allocator::deallocate(newNode);
+		throw;
+	}
+	if (headPtr != nullptr)
+		headPtr->addRef();
+	return PersistentList<ItemType, Allocator>(newNode, itemCount + 1);
+}
+// Share everything after the first Node
+template<class ItemType, class Allocator>
+PersistentList<ItemType, Allocator> PersistentList<ItemType, Allocator>::pop() const
+{
+	if (headPtr == nullptr) return PersistentList<ItemType, Allocator>();
+	PersistentNode<ItemType>* nextPtr = headPtr->getNext();
+	if (nextPtr != nullptr)
+		nextPtr->addRef();
+	return PersistentList<ItemType, Allocator>(nextPtr, itemCount - 1);
+}
+template<class ItemType, class Allocator>
+inline const ItemType& PersistentList<ItemType, Allocator>::front(void) const
+{
+	assert(itemCount > 0);
+	return headPtr->getItem();
+}
+// Up to the user to enter a legal position
+template<class ItemType, class Allocator>
+const ItemType& PersistentList<ItemType, Allocator>::getEntry(int position) const
+{
+	assert((position >= 1) && (position <= itemCount));
+	const PersistentNode<ItemType>* curPtr = headPtr;
+	for (int skip = 1; skip < position; ++skip)
+		curPtr = curPtr->getNext();
+	return curPtr->getItem();
+}
+template<class ItemType, class Allocator>
+inline int PersistentList<ItemType, Allocator>::getLength() const
+{
+	return itemCount;
+}
+template<class ItemType, class Allocator>
+inline bool PersistentList<ItemType, Allocator>::isEmpty() const
+{
+	return itemCount == 0;
+}
+template<class ItemType, class Allocator>
+bool PersistentList<ItemType, Allocator>::isInList(const ItemType& anEntry) const
+{
+	for (const PersistentNode<ItemType>* curPtr = headPtr; curPtr != nullptr; curPtr = curPtr->getNext())
+		if (curPtr->getItem() == anEntry) return true;
+	return false;
+}
+template<class ItemType, class Allocator>
+void PersistentList<ItemType, Allocator>::printList(void) const
+{
+	for (const PersistentNode<ItemType>* curPtr = headPtr; curPtr != nullptr; curPtr = curPtr->getNext())
+		std::cout << curPtr->getItem();
+}
+template<class ItemType, class Allocator>
+inline typename PersistentList<ItemType, Allocator>::const_iterator PersistentList<ItemType, Allocator>::begin(void) const
+{
+	return const_iterator(headPtr);
+}
+template<class ItemType, class Allocator>
+inline typename PersistentList<ItemType, Allocator>::const_iterator PersistentList<ItemType, Allocator>::cbegin(void) const
+{
+	return const_iterator(headPtr);
+}
+template<class ItemType, class Allocator>
+inline typename PersistentList<ItemType, Allocator>::const_iterator PersistentList<ItemType, Allocator>::end(void) const
+{
+	return const_iterator(nullptr);
+}
+template<class ItemType, class Allocator>
+inline typename PersistentList<ItemType, Allocator>::const_iterator PersistentList<ItemType, Allocator>::cend(void) const
+{
+	return const_iterator(nullptr);
+}
+#endif
@@ -0,0 +1,396 @@
+/*
+* SimdKernels.h
+* Daniel Salazar
+* 10/18/2026
+* find, count, min, max and sum over a contiguous block of items,
+* for the lists that keep their items in arrays (UnrolledList's
+* Nodes, IndexedList's pool)
+* SimdKernels<ItemType> is plain scalar code for any ItemType
+* For int, double and char on x86 it compares and adds a whole
+* vector of items per instruction: SSE2 always, AVX2 when the CPU
+* has it, picked once at run time
+* Define LINKEDLIST_NO_SIMD to always use the scalar code
+* Sums of floating point items are added in a different order than
+* a loop would, so they may differ in the last bits; items that
+* are NaN give unspecified min and max
+* SimdKernels<ItemType> is the interface
+*/
+#ifndef SIMDKERNELS_H
+#define SIMDKERNELS_H
+#include <algorithm>	// min, max
+#include <limits>		// numeric_limits
+#include <type_traits>	// conditional, is_integral, is_floating_point
+#if !defined(LINKEDLIST_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+	(defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define LINKEDLIST_SIMD_X86
+#include <immintrin.h>	// SSE2 and AVX2 intrinsics
+#endif
+// What sum adds items up in: long long for integers, double for
+// float and double, ItemType itself for anything else
+template<class ItemType>
+struct KernelSum
+{
+	typedef typename std::conditional<std::is_integral<ItemType>::value, long long,
+		typename std::conditional<std::is_floating_point<ItemType>::value && sizeof(ItemType) <= sizeof(double),
+			double, ItemType>::type>::type type;
+};
+// Scalar kernels, ItemType needs == for find and count,
+// < for min and max, + for sum
+template<class ItemType>
+struct ScalarKernels
+{
+	typedef typename KernelSum<ItemType>::type SumType;
+	// First item equal to value, last if there is none
+	static const ItemType* find(const ItemType* first, const ItemType* last, const ItemType& value);
+	// Number of items equal to value
+	static long long count(const ItemType* first, const ItemType* last, const ItemType& value);
+	// Least and greatest items, the block must not be empty
+	static ItemType minItem(const ItemType* first, const ItemType* last);
+	static ItemType maxItem(const ItemType* first, const ItemType* last);
+	// Sum of the items, SumType() for an empty block
+	static SumType sum(const ItemType* first, const ItemType* last);
+};
+template<class ItemType>
+const ItemType* ScalarKernels<ItemType>::find(const ItemType* first, const ItemType* last, const ItemType& value)
+{
+	for (; first != last; ++first)
+		if (*first == value) return first;
+	return last;
+}
+template<class ItemType>
+long long ScalarKernels<ItemType>::count(const ItemType* first, const ItemType* last, const ItemType& value)
+{
+	long long total = 0;
+	for (; first != last; ++first)
+		if (*first == value) ++total;
+	return total;
+}
+template<class ItemType>
+ItemType ScalarKernels<ItemType>::minItem(const ItemType* first, const ItemType* last)
+{
+	ItemType least = *first;
+	for (++first; first != last; ++first)
+		if (*first < least) least = *first;
+	return least;
+}
+template<class ItemType>
+ItemType ScalarKernels<ItemType>::maxItem(const ItemType* first, const ItemType* last)
+{
+	ItemType greatest = *first;
+	for (++first; first != last; ++first)
+		if (greatest < *first) greatest = *first;
+	return greatest;
+}
+template<class ItemType>
+typename ScalarKernels<ItemType>::SumType ScalarKernels<ItemType>::sum(const ItemType* first, const ItemType* last)
+{
+	SumType total = SumType();
+	for (; first != last; ++first)
+		total = total + *first;
+	return total;
+}
+// Any ItemType without vector kernels
+template<class ItemType>
+struct SimdKernels : ScalarKernels<ItemType>
+{
+};
+#ifdef LINKEDLIST_SIMD_X86
+#define LINKEDLIST_AVX2 __attribute__((target("avx2")))
+// A vector policy gives the kernels below, for one ItemType and
+// one instruction set:
+//  Vec and Lanes, the vector and how many items it holds
+//  load, splat: read Lanes items, or fill every lane with one
+//  eqMask: one bit per lane, set where the lanes are equal
+//  minv, maxv: lane by lane least and greatest
+//  Acc, accZero, accAdd, accReduce: a running sum wide enough
+//   not to overflow, and its total after count items
+// SSE2, 4 ints
+struct Sse2Int
+{
+	typedef int Item;
+	typedef __m128i Vec;
+	typedef __m128i Acc;
+	static const int Lanes = 4;
+	static Vec load(const Item* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+	static Vec splat(Item value) { return _mm_set1_epi32(value); }
+	static unsigned eqMask(Vec a, Vec b) { return unsigned(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)))); }
+	// No 32-bit min/max before SSE4.1, so select through a compare
+	static Vec minv(Vec a, Vec b)
+	{
+		__m128i greater = _mm_cmpgt_epi32(a, b);
+		return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+	}
+	static Vec maxv(Vec a, Vec b)
+	{
+		__m128i greater = _mm_cmpgt_epi32(a, b);
+		return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+	}
+	static Acc accZero(void) { return _mm_setzero_si128(); }
+	// Sign extend each half to 64 bits before adding
+	static Acc accAdd(Acc acc, Vec v)
+	{
+		__m128i sign = _mm_srai_epi32(v, 31);
+		acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, sign));
+		return _mm_add_epi64(acc, _mm_unpackhi_epi32(v, sign));
+	}
+	static long long accReduce(Acc acc, long long count)
+	{
+		(void)count;
+		long long lanes[2];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+		return lanes[0] + lanes[1];
+	}
+	static void store(Item* p, Vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+};
+// SSE2, 2 doubles
+struct Sse2Double
+{
+	typedef double Item;
+	typedef __m128d Vec;
+	typedef __m128d Acc;
+	static const int Lanes = 2;
+	static Vec load(const Item* p) { return _mm_loadu_pd(p); }
+	static Vec splat(Item value) { return _mm_set1_pd(value); }
+	static unsigned eqMask(Vec a, Vec b) { return unsigned(_mm_movemask_pd(_mm_cmpeq_pd(a, b))); }
+	static Vec minv(Vec a, Vec b) { return _mm_min_pd(a, b); }
+	static Vec maxv(Vec a, Vec b) { return _mm_max_pd(a, b); }
+	static Acc accZero(void) { return _mm_setzero_pd(); }
+	static Acc accAdd(Acc acc, Vec v) { return _mm_add_pd(acc, v); }
+	static double accReduce(Acc acc, long long count)
+	{
+		(void)count;
+		double lanes[2];
+		_mm_storeu_pd(lanes, acc);
+		return lanes[0] + lanes[1];
+	}
+	static void store(Item* p, Vec v) { _mm_storeu_pd(p, v); }
+};
+// SSE2, 16 chars
+// Signed chars are flipped by 0x80 into unsigned order, where SSE2
+// has min, max and a sum of absolute differences against zero
+struct Sse2Char
+{
+	typedef char Item;
+	typedef __m128i Vec;
+	typedef __m128i Acc;
+	static const int Lanes = 16;
+	static const int Bias = std::numeric_limits<char>::is_signed ? 0x80 : 0;
+	static Vec load(const Item* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+	static Vec splat(Item value) { return _mm_set1_epi8(value); }
+	static unsigned eqMask(Vec a, Vec b) { return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))); }
+	static Vec flip(Vec v) { return _mm_xor_si128(v, _mm_set1_epi8(char(Bias))); }
+	static Vec minv(Vec a, Vec b) { return flip(_mm_min_epu8(flip(a), flip(b))); }
+	static Vec maxv(Vec a, Vec b) { return flip(_mm_max_epu8(flip(a), flip(b))); }
+	static Acc accZero(void) { return _mm_setzero_si128(); }
+	static Acc accAdd(Acc acc, Vec v) { return _mm_add_epi64(acc, _mm_sad_epu8(flip(v), _mm_setzero_si128())); }
+	// Every item was added Bias too high
+	static long long accReduce(Acc acc, long long count)
+	{
+		long long lanes[2];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+		return lanes[0] + lanes[1] - Bias * count;
+	}
+	static void store(Item* p, Vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+};
+// AVX2, 8 ints
+struct Avx2Int
+{
+	typedef int Item;
+	typedef __m256i Vec;
+	typedef __m256i Acc;
+	static const int Lanes = 8;
+	LINKEDLIST_AVX2 static Vec load(const Item* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+	LINKEDLIST_AVX2 static Vec splat(Item value) { return _mm256_set1_epi32(value); }
+	LINKEDLIST_AVX2 static unsigned eqMask(Vec a, Vec b) { return unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)))); }
+	LINKEDLIST_AVX2 static Vec minv(Vec a, Vec b) { return _mm256_min_epi32(a, b); }
+	LINKEDLIST_AVX2 static Vec maxv(Vec a, Vec b) { return _mm256_max_epi32(a, b); }
+	LINKEDLIST_AVX2 static Acc accZero(void) { return _mm256_setzero_si256(); }
+	LINKEDLIST_AVX2 static Acc accAdd(Acc acc, Vec v)
+	{
+		acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+		return _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+	}
+	LINKEDLIST_AVX2 static long long accReduce(Acc acc, long long count)
+	{
+		(void)count;
+		long long lanes[4];
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+		return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	}
+	LINKEDLIST_AVX2 static void store(Item* p, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+};
+// AVX2, 4 doubles
+struct Avx2Double
+{
+	typedef double Item;
+	typedef __m256d Vec;
+	typedef __m256d Acc;
+	static const int Lanes = 4;
+	LINKEDLIST_AVX2 static Vec load(const Item* p) { return _mm256_loadu_pd(p); }
+	LINKEDLIST_AVX2 static Vec splat(Item value) { return _mm256_set1_pd(value); }
+	LINKEDLIST_AVX2 static unsigned eqMask(Vec a, Vec b) { return unsigned(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ))); }
+	LINKEDLIST_AVX2 static Vec minv(Vec a, Vec b) { return _mm256_min_pd(a, b); }
+	LINKEDLIST_AVX2 static Vec maxv(Vec a, Vec b) { return _mm256_max_pd(a, b); }
+	LINKEDLIST_AVX2 static Acc accZero(void) { return _mm256_setzero_pd(); }
+	LINKEDLIST_AVX2 static Acc accAdd(Acc acc, Vec v) { return _mm256_add_pd(acc, v); }
+	LINKEDLIST_AVX2 static double accReduce(Acc acc, long long count)
+	{
+		(void)count;
+		double lanes[4];
+		_mm256_storeu_pd(lanes, acc);
+		return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+	}
+	LINKEDLIST_AVX2 static void store(Item* p, Vec v) { _mm256_storeu_pd(p, v); }
+};
+// AVX2, 32 chars, signed min and max are native
+struct Avx2Char
+{
+	typedef char Item;
+	typedef __m256i Vec;
+	typedef __m256i Acc;
+	static const int Lanes = 32;
+	static const int Bias = std::numeric_limits<char>::is_signed ? 0x80 : 0;
+	LINKEDLIST_AVX2 static Vec load(const Item* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+	LINKEDLIST_AVX2 static Vec splat(Item value) { return _mm256_set1_epi8(value); }
+	LINKEDLIST_AVX2 static unsigned eqMask(Vec a, Vec b) { return unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))); }
+	LINKEDLIST_AVX2 static Vec minv(Vec a, Vec b)
+	{
+		return std::numeric_limits<char>::is_signed ? _mm256_min_epi8(a, b) : _mm256_min_epu8(a, b);
+	}
+	LINKEDLIST_AVX2 static Vec maxv(Vec a, Vec b)
+	{
+		return std::numeric_limits<char>::is_signed ? _mm256_max_epi8(a, b) : _mm256_max_epu8(a, b);
+	}
+	LINKEDLIST_AVX2 static Acc accZero(void) { return _mm256_setzero_si256(); }
+	LINKEDLIST_AVX2 static Acc accAdd(Acc acc, Vec v)
+	{
+		Vec flipped = _mm256_xor_si256(v, _mm256_set1_epi8(char(Bias)));
+		return _mm256_add_epi64(acc, _mm256_sad_epu8(flipped, _mm256_setzero_si256()));
+	}
+	LINKEDLIST_AVX2 static long long accReduce(Acc acc, long long count)
+	{
+		long long lanes[4];
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+		return lanes[0] + lanes[1] + lanes[2] + lanes[3] - Bias * count;
+	}
+	LINKEDLIST_AVX2 static void store(Item* p, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+};
+// The kernels, written once over a policy
+// Whole vectors first, then the last few items one at a time
+// The bodies are a macro so each copy can carry its own target
+// attribute: VectorKernels expands them as plain functions,
+// Avx2Kernels as functions compiled for AVX2, which can only run
+// once the CPU is known to have it (sharing one inline body instead
+// would pass AVX vectors through non-AVX code)
+#define LINKEDLIST_VECTOR_KERNELS(TARGET) \
+	typedef typename Policy::Item Item; \
+	typedef typename KernelSum<Item>::type SumType; \
+	TARGET static const Item* find(const Item* first, const Item* last, Item value) \
+	{ \
+		typename Policy::Vec target = Policy::splat(value); \
+		for (; last - first >= Policy::Lanes; first += Policy::Lanes) \
+		{ \
+			unsigned mask = Policy::eqMask(Policy::load(first), target); \
+			if (mask != 0) return first + __builtin_ctz(mask); \
+		} \
+		return ScalarKernels<Item>::find(first, last, value); \
+	} \
+	TARGET static long long count(const Item* first, const Item* last, Item value) \
+	{ \
+		typename Policy::Vec target = Policy::splat(value); \
+		long long total = 0; \
+		for (; last - first >= Policy::Lanes; first += Policy::Lanes) \
+			total += __builtin_popcount(Policy::eqMask(Policy::load(first), target)); \
+		return total + ScalarKernels<Item>::count(first, last, value); \
+	} \
+	TARGET static Item minItem(const Item* first, const Item* last) \
+	{ \
+		if (last - first < Policy::Lanes) return ScalarKernels<Item>::minItem(first, last); \
+		typename Policy::Vec least = Policy::load(first); \
+		for (first += Policy::Lanes; last - first >= Policy::Lanes; first += Policy::Lanes) \
+			least = Policy::minv(least, Policy::load(first)); \
+		Item lanes[Policy::Lanes]; \
+		Policy::store(lanes, least); \
+		Item result = ScalarKernels<Item>::minItem(lanes, lanes + Policy::Lanes); \
+		return first == last ? result : std::min(result, ScalarKernels<Item>::minItem(first, last)); \
+	} \
+	TARGET static Item maxItem(const Item* first, const Item* last) \
+	{ \
+		if (last - first < Policy::Lanes) return ScalarKernels<Item>::maxItem(first, last); \
+		typename Policy::Vec greatest = Policy::load(first); \
+		for (first += Policy::Lanes; last - first >= Policy::Lanes; first += Policy::Lanes) \
+			greatest = Policy::maxv(greatest, Policy::load(first)); \
+		Item lanes[Policy::Lanes]; \
+		Policy::store(lanes, greatest); \
+		Item result = ScalarKernels<Item>::maxItem(lanes, lanes + Policy::Lanes); \
+		return first == last ? result : std::max(result, ScalarKernels<Item>::maxItem(first, last)); \
+	} \
+	TARGET static SumType sum(const Item* first, const Item* last) \
+	{ \
+		typename Policy::Acc total = Policy::accZero(); \
+		long long count = 0; \
+		for (; last - first >= Policy::Lanes; first += Policy::Lanes, count += Policy::Lanes) \
+			total = Policy::accAdd(total, Policy::load(first)); \
+		return SumType(Policy::accReduce(total, count)) + ScalarKernels<Item>::sum(first, last); \
+	}
+#define LINKEDLIST_NO_TARGET
+template<class Policy>
+struct VectorKernels
+{
+	LINKEDLIST_VECTOR_KERNELS(LINKEDLIST_NO_TARGET)
+};
+template<class Policy>
+struct Avx2Kernels
+{
+	LINKEDLIST_VECTOR_KERNELS(LINKEDLIST_AVX2)
+};
+// Asks the CPU once whether it has AVX2
+inline bool hasAvx2(void)
+{
+	static const bool avx2 = __builtin_cpu_supports("avx2") != 0;
+	return avx2;
+}
+// Picks the AVX2 or SSE2 kernels on every call
+template<class Sse2Policy, class Avx2Policy>
+struct DispatchKernels
+{
+	typedef typename Sse2Policy::Item Item;
+	typedef typename KernelSum<Item>::type SumType;
+	static const Item* find(const Item* first, const Item* last, const Item& value)
+	{
+		return hasAvx2() ? Avx2Kernels<Avx2Policy>::find(first, last, value) : VectorKernels<Sse2Policy>::find(first, last, value);
+	}
+	static long long count(const Item* first, const Item* last, const Item& value)
+	{
+		return hasAvx2() ? Avx2Kernels<Avx2Policy>::count(first, last, value) : VectorKernels<Sse2Policy>::count(first, last, value);
+	}
+	static Item minItem(const Item* first, const Item* last)
+	{
+		return hasAvx2() ? Avx2Kernels<Avx2Policy>::minItem(first, last) : VectorKernels<Sse2Policy>::minItem(first, last);
+	}
+	static Item maxItem(const Item* first, const Item* last)
+	{
+		return hasAvx2() ? Avx2Kernels<Avx2Policy>::maxItem(first, last) : VectorKernels<Sse2Policy>::maxItem(first, last);
+	}
+	static SumType sum(const Item* first, const Item* last)
+	{
+		return hasAvx2() ? Avx2Kernels<Avx2Policy>::sum(first, last) : VectorKernels<Sse2Policy>::sum(first, last);
+	}
+};
+template<>
+struct SimdKernels<int> : DispatchKernels<Sse2Int, Avx2Int>
+{
+};
+template<>
+struct SimdKernels<double> : DispatchKernels<Sse2Double, Avx2Double>
+{
+};
+template<>
+struct SimdKernels<char> : DispatchKernels<Sse2Char, Avx2Char>
+{
+};
+#undef LINKEDLIST_AVX2
+#undef LINKEDLIST_NO_TARGET
+#undef LINKEDLIST_VECTOR_KERNELS
+#endif
+#endif
@@ -0,0 +1,475 @@
+/*
+* SortedList.h
+* Daniel Salazar
+* 10/18/2026
+* A LinkedList that keeps its items in ascending order and
+* indexes them with a skip list
+* The items live in the same singly linked Node<ItemType> chain
+* LinkedList uses, so iterating is a plain walk down the Nodes
+* Above the chain sit up to MaxLevel levels of SkipIndex towers
+* Each level links about a quarter of the entries of the level below
+* insertSorted, isInList, lower_bound and remove drop down the levels
+* in O(log n) expected instead of walking the whole chain
+* SkipIndex<ItemType> is one entry of a tower
+* SortedList<ItemType, Allocator, IndexAllocator> is the collection
+*/
+#ifndef SORTEDLIST_H
+#define SORTEDLIST_H
+#include "LinkedList.h"
+// One level of a Node's tower
+// right is the next SkipIndex on the same level
+// down is this Node's SkipIndex one level lower, nullptr on the lowest
+template<class ItemType>
+struct SkipIndex
+{
+	Node<ItemType>* node;
+	SkipIndex<ItemType>* right;
+	SkipIndex<ItemType>* down;
+};
+// Sorted List of Nodes with a skip list index
+// Positional insert and setEntry would break the order,
+// so SortedList does not implement ListInterface
+// Items only need operator<, equal items are kept in insertion order
+template<class ItemType, class Allocator = SlabAllocator<Node<ItemType> >,
+	class IndexAllocator = SlabAllocator<SkipIndex<ItemType> > >
+class SortedList
+{
+public:
+	// Levels of index above the Node chain
+	// Promotion odds are 1 in 4, so 16 levels cover 4^16 items
+	static const int MaxLevel = 16;
+private:
+	// head.getNext() points to nullptr/First Node
+	NodeBase<ItemType> head;
+	// Points to nullptr/Last Node
+	Node<ItemType>* tailPtr;
+	// Count of Nodes
+	int itemCount;
+	// Number of levels in use, 0 when no Node has a tower
+	int levels;
+	// Sentinel at the left end of each level, its node is nullptr
+	// levelHead[l].down is levelHead[l - 1]
+	SkipIndex<ItemType> levelHead[MaxLevel];
+	// xorshift state for picking tower heights
+	unsigned int seed;
+	// Links each level's sentinel to the one below
+	void initLevels(void);
+	// Random tower height, 0 with odds 3 in 4, 1 with 3 in 16, ...
+	int randomLevel(void);
+	// Fills preds[l] with the last SkipIndex on level l that comes
+	// before anEntry and returns the last NodeBase before it
+	// Before means less than anEntry, or not greater if after is true
+	NodeBase<ItemType>* findPreds(const ItemType& anEntry, bool after, SkipIndex<ItemType>** preds) const;
+	// Unlinks curPtr's tower, preds[l] is the SkipIndex before it
+	void unlinkTower(Node<ItemType>* curPtr, SkipIndex<ItemType>** preds);
+	// Drops levels left with no SkipIndex
+	void trimLevels(void);
+	// Constructs a new Node in storage from Allocator
+	Node<ItemType>* getListEl(const ItemType& newEntry);
+	// Destroys a removed Node and returns it to Allocator
+	void freeListEl(Node<ItemType>* curPtr);
+public:
+	// Policy Nodes are allocated with
+	typedef Allocator allocator_type;
+	// Forward iterators over the items, read only so the order holds
+	typedef ListIterator<ItemType, const ItemType> iterator;
+	typedef ListIterator<ItemType, const ItemType> const_iterator;
+	// Default constructor
+	SortedList();
+	// List Copy Constructor
+	SortedList(const SortedList<ItemType, Allocator, IndexAllocator>& aList);
+	// List Move Constructor, takes over aList's Nodes and towers
+	SortedList(SortedList<ItemType, Allocator, IndexAllocator>&& aList) noexcept;
+	// Assignment operator copies aList into thisList
+	SortedList<ItemType, Allocator, IndexAllocator>& operator=(const SortedList<ItemType, Allocator, IndexAllocator>& aList);
+	// Move assignment, takes over aList's Nodes and towers
+	SortedList<ItemType, Allocator, IndexAllocator>& operator=(SortedList<ItemType, Allocator, IndexAllocator>&& aList) noexcept;
+	// Destructor
+	~SortedList();
+	// Smallest and largest items, O(1)
+	const ItemType& front(void) const;
+	const ItemType& back(void) const;
+	// Get number of Nodes in List
+	int getLength() const;
+	// Checks if itemCount is 0
+	bool isEmpty() const;
+	// Skip list search for anEntry
+	bool isInList(const ItemType& anEntry) const;
+	// Iterator to the first item not less than anEntry, or end
+	const_iterator lower_bound(const ItemType& anEntry) const;
+	// Inserts a Node in ascending order, after any equal items
+	void insertSorted(const ItemType& newEntry);
+	// Removes the first Node equal to anEntry and returns it to Allocator
+	bool remove(const ItemType& anEntry);
+	// Removes first Node and returns it to Allocator
+	bool pop();
+	// Removes all Nodes and towers in the List
+	void clear(void);
+	// Displays all Node's item to stdout in ascending order
+	void printList(void) const;
+	// Iterator to the first item
+	const_iterator begin(void) const;
+	const_iterator cbegin(void) const;
+	// Iterator past the last item
+	const_iterator end(void) const;
+	const_iterator cend(void) const;
+};
+// Every level starts out empty
+template<class ItemType, class Allocator, class IndexAllocator>
+void SortedList<ItemType, Allocator, IndexAllocator>::initLevels(void)
+{
+	for (int l = 0; l < MaxLevel; ++l)
+	{
+		levelHead[l].node = nullptr;
+		levelHead[l].right = nullptr;
+		levelHead[l].down = (l == 0) ? nullptr : &levelHead[l - 1];
+	}
+}
+// Step the xorshift state
+// Count pairs of zero bits from the bottom, each pair is one level
+template<class ItemType, class Allocator, class IndexAllocator>
+inline int SortedList<ItemType, Allocator, IndexAllocator>::randomLevel(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	unsigned int bits = seed;
+	int level = 0;
+	while ((bits & 3) == 0 && level < MaxLevel)
+	{
+		++level;
+		bits >>= 2;
+	}
+	return level;
+}
+// Start at the top level's sentinel
+// On each level, step right while the next SkipIndex comes before
+// anEntry, remember where the level was left and drop down
+// Levels not in use have only their sentinel to remember
+// From the last lowest level SkipIndex (or head), inchworm
+// down the Node chain the same way
+template<class ItemType, class Allocator, class IndexAllocator>
+NodeBase<ItemType>* SortedList<ItemType, Allocator, IndexAllocator>::findPreds(const ItemType& anEntry, bool after, SkipIndex<ItemType>** preds) const
+{
+	SkipIndex<ItemType>* curPtr = const_cast<SkipIndex<ItemType>*>(&levelHead[levels > 0 ? levels - 1 : 0]);
+	for (int l = MaxLevel - 1; l >= levels; --l)
+		preds[l] = const_cast<SkipIndex<ItemType>*>(&levelHead[l]);
+	for (int l = levels - 1; l >= 0; --l)
+	{
+		while (curPtr->right != nullptr &&
+			(after ? !(anEntry < curPtr->right->node->getItem())
+				: curPtr->right->node->getItem() < anEntry))
+			curPtr = curPtr->right;
+		preds[l] = curPtr;
+		if (l > 0) curPtr = curPtr->down;
+	}
+	NodeBase<ItemType>* prevPtr = (levels == 0 || curPtr->node == nullptr)
+		? const_cast<NodeBase<ItemType>*>(&head) : curPtr->node;
+	Node<ItemType>* nextPtr;
+	while ((nextPtr = prevPtr->getNext()) != nullptr &&
+		(after ? !(anEntry < nextPtr->getItem()) : nextPtr->getItem() < anEntry))
+		prevPtr = nextPtr;
+	return prevPtr;
+}
+// Only the lowest levels a Node was promoted to point at it, so
+// stop at the first level whose next SkipIndex is not curPtr's
+// Free each of its SkipIndexes
+template<class ItemType, class Allocator, class IndexAllocator>
+void SortedList<ItemType, Allocator, IndexAllocator>::unlinkTower(Node<ItemType>* curPtr, SkipIndex<ItemType>** preds)
+{
+	for (int l = 0; l < levels; ++l)
+	{
+		SkipIndex<ItemType>* indexPtr = preds[l]->right;
+		if (indexPtr == nullptr || indexPtr->node != curPtr) break;
+		preds[l]->right = indexPtr->right;
+		IndexAllocator::deallocate(indexPtr);
+	}
+	trimLevels();
+}
+// Lower levels while the top one is empty
+template<class ItemType, class Allocator, class IndexAllocator>
+inline void SortedList<ItemType, Allocator, IndexAllocator>::trimLevels(void)
+{
+	while (levels > 0 && levelHead[levels - 1].right == nullptr)
+		--levels;
+}
+// Get storage from Allocator and copy newEntry into an unlinked Node
+// If the copy throws, give the storage back and rethrow
+template<class ItemType, class Allocator, class IndexAllocator>
+inline Node<ItemType>* SortedList<ItemType, Allocator, IndexAllocator>::getListEl(const ItemType& newEntry)
+{
+	Node<ItemType>* storage = Allocator::allocate();
+	try
+	{
+		new (storage) Node<ItemType>(newEntry);
+	}
+	catch (...)
+	{
+		Allocator::deallocate(storage);
+		throw;
+	}
+	return storage;
+}
+// Destroy a removed Node and hand its storage back to Allocator
+template<class ItemType, class Allocator, class IndexAllocator>
+inline void SortedList<ItemType, Allocator, IndexAllocator>::freeListEl(Node<ItemType>* curPtr)
+{
+	curPtr->~Node<ItemType>();
+	Allocator::deallocate(curPtr);
+}
+// Initiate the List's head, tail, itemCount and levels
+// Seed from the List's address so lists built together differ
+template<class ItemType, class Allocator, class IndexAllocator>
+SortedList<ItemType, Allocator, IndexAllocator>::SortedList() :
+	head(nullptr), tailPtr(nullptr), itemCount(0), levels(0),
+	seed(static_cast<unsigned int>(reinterpret_cast<std::size_t>(this) >> 4) | 1u)
+{
+	initLevels();
+}
+// Start out empty
+// aList is already in order, so every copy lands at the tail
+template<class ItemType, class Allocator, class IndexAllocator>
+SortedList<ItemType, Allocator, IndexAllocator>::SortedList(const SortedList<ItemType, Allocator, IndexAllocator>& aList) :
+	head(nullptr), tailPtr(nullptr), itemCount(0), levels(0),
+	seed(static_cast<unsigned int>(reinterpret_cast<std::size_t>(this) >> 4) | 1u)
+{
+	initLevels();
+	for (Node<ItemType> *rhs = aList.head.getNext(); rhs != nullptr; rhs = rhs->getNext())
+		insertSorted(rhs->getItem());
+}
+// Takes aList's chain, towers, tail and count
+// The sentinels stay put, only their right links move
+// Leaves aList empty
+template<class ItemType, class Allocator, class IndexAllocator>
+SortedList<ItemType, Allocator, IndexAllocator>::SortedList(SortedList<ItemType, Allocator, IndexAllocator>&& aList) noexcept :
+	head(aList.head.getNext()), tailPtr(aList.tailPtr), itemCount(aList.itemCount),
+	levels(aList.levels), seed(aList.seed)
+{
+	initLevels();
+	for (int l = 0; l < MaxLevel; ++l)
+	{
+		levelHead[l].right = aList.levelHead[l].right;
+		aList.levelHead[l].right = nullptr;
+	}
+	aList.head.setNext(nullptr);
+	aList.tailPtr = nullptr;
+	aList.itemCount = 0;
+	aList.levels = 0;
+}
+// Prevent from self assignment
+// Clears thisList
+// Copies all aList items into thisList
+template<class ItemType, class Allocator, class IndexAllocator>
+SortedList<ItemType, Allocator, IndexAllocator>& SortedList<ItemType, Allocator, IndexAllocator>::operator=(const SortedList<ItemType, Allocator, IndexAllocator>& aList)
+{
+	assert(this != &aList);
+	clear();
+	for (Node<ItemType> *rhs = aList.head.getNext(); rhs != nullptr; rhs = rhs->getNext())
+		insertSorted(rhs->getItem());
+	return *this;
+}
+// Clears thisList
+// Takes aList's chain, towers, tail and count
+// Leaves aList empty
+template<class ItemType, class Allocator, class IndexAllocator>
+SortedList<ItemType, Allocator, IndexAllocator>& SortedList<ItemType, Allocator, IndexAllocator>::operator=(SortedList<ItemType, Allocator, IndexAllocator>&& aList) noexcept
+{
+	if (this == &aList) return *this;
+	clear();
+	head.setNext(aList.head.getNext());
+	tailPtr = aList.tailPtr;
+	itemCount = aList.itemCount;
+	levels = aList.levels;
+	for (int l = 0; l < MaxLevel; ++l)
+	{
+		levelHead[l].right = aList.levelHead[l].right;
+		aList.levelHead[l].right = nullptr;
+	}
+	aList.head.setNext(nullptr);
+	aList.tailPtr = nullptr;
+	aList.itemCount = 0;
+	aList.levels = 0;
+	return *this;
+}
+// Destructor just uses clear
+template<class ItemType, class Allocator, class IndexAllocator>
+SortedList<ItemType, Allocator, IndexAllocator>::~SortedList()
+{
+	clear();
+}
+// Up to the user to check the List isn't empty
+// Returns the first Node's item
+template<class ItemType, class Allocator, class IndexAllocator>
+inline const ItemType& SortedList<ItemType, Allocator, IndexAllocator>::front(void) const
+{
+	assert(itemCount > 0);
+	return head.getNext()->getItem();
+}
+// Up to the user to check the List isn't empty
+// Returns the last Node's item
+template<class ItemType, class Allocator, class IndexAllocator>
+inline const ItemType& SortedList<ItemType, Allocator, IndexAllocator>::back(void) const
+{
+	assert(itemCount > 0);
+	return tailPtr->getItem();
+}
+// Returns count of Nodes
+template<class ItemType, class Allocator, class IndexAllocator>
+int SortedList<ItemType, Allocator, IndexAllocator>::getLength() const
+{
+	return itemCount;
+}
+// Check if List has zero Nodes
+template<class ItemType, class Allocator, class IndexAllocator>
+bool SortedList<ItemType, Allocator, IndexAllocator>::isEmpty() const
+{
+	return itemCount == 0;
+}
+// The first item not less than anEntry is anEntry if it is in thisList
+template<class ItemType, class Allocator, class IndexAllocator>
+bool SortedList<ItemType, Allocator, IndexAllocator>::isInList(const ItemType& anEntry) const
+{
+	const_iterator curIter = lower_bound(anEntry);
+	return curIter != end() && !(anEntry < *curIter);
+}
+// The Node after the last one less than anEntry
+template<class ItemType, class Allocator, class IndexAllocator>
+typename SortedList<ItemType, Allocator, IndexAllocator>::const_iterator
+	SortedList<ItemType, Allocator, IndexAllocator>::lower_bound(const ItemType& anEntry) const
+{
+	SkipIndex<ItemType>* preds[MaxLevel];
+	return const_iterator(findPreds(anEntry, false, preds)->getNext());
+}
+// Find the last Node not greater than newEntry and the last
+// SkipIndex on each level before newEntry
+// Link a new Node after it, fixing tailPtr if it went last
+// Pick a tower height and link one SkipIndex per level,
+// bottom up, raising levels if the tower is the tallest yet
+template<class ItemType, class Allocator, class IndexAllocator>
+void SortedList<ItemType, Allocator, IndexAllocator>::insertSorted(const ItemType& newEntry)
+{
+	SkipIndex<ItemType>* preds[MaxLevel];
+	NodeBase<ItemType>* prevPtr = findPreds(newEntry, true, preds);
+	Node<ItemType>* newNode = getListEl(newEntry);
+	newNode->setNext(prevPtr->getNext());
+	prevPtr->setNext(newNode);
+	if (newNode->getNext() == nullptr)
+		tailPtr = newNode;
+	++itemCount;
+	int height = randomLevel();
+	SkipIndex<ItemType>* downPtr = nullptr;
+	for (int l = 0; l < height; ++l)
+	{
+		SkipIndex<ItemType>* indexPtr = IndexAllocator::allocate();
+		indexPtr->node = newNode;
+		indexPtr->right = preds[l]->right;
+		indexPtr->down = downPtr;
+		preds[l]->right = indexPtr;
+		downPtr = indexPtr;
+	}
+	if (height > levels)
+		levels = height;
+}
+// Find the first Node not less than anEntry
+// If it is missing or greater, item not found
+// Unlink its tower, then the Node itself
+// If the last Node was unlinked, prevPtr is the new tail
+// Reduce item Count
+// Return Node to Allocator
+template<class ItemType, class Allocator, class IndexAllocator>
+bool SortedList<ItemType, Allocator, IndexAllocator>::remove(const ItemType& anEntry)
+{
+	SkipIndex<ItemType>* preds[MaxLevel];
+	NodeBase<ItemType>* prevPtr = findPreds(anEntry, false, preds);
+	Node<ItemType>* curPtr = prevPtr->getNext();
+	if (curPtr == nullptr || anEntry < curPtr->getItem())
+		return false;
+	unlinkTower(curPtr, preds);
+	prevPtr->setNext(curPtr->getNext());
+	if (curPtr == tailPtr)
+		tailPtr = (prevPtr == &head) ? nullptr : static_cast<Node<ItemType>*>(prevPtr);
+	--itemCount;
+	freeListEl(curPtr);
+	return true;
+}
+// Removes the first Node in thisList
+// Any tower it has sits right after the sentinels
+template<class ItemType, class Allocator, class IndexAllocator>
+bool SortedList<ItemType, Allocator, IndexAllocator>::pop()
+{
+	Node<ItemType>* curPtr = head.getNext();
+	if (curPtr == nullptr) return false;
+	SkipIndex<ItemType>* preds[MaxLevel];
+	for (int l = 0; l < MaxLevel; ++l)
+		preds[l] = &levelHead[l];
+	unlinkTower(curPtr, preds);
+	head.setNext(curPtr->getNext());
+	if (head.getNext() == nullptr)
+		tailPtr = nullptr;
+	--itemCount;
+	freeListEl(curPtr);
+	return true;
+}
+// Return every level's SkipIndexes to IndexAllocator
+// Iterate down the Node chain returning Nodes to Allocator
+// Zero out thisList
+template<class ItemType, class Allocator, class IndexAllocator>
+void SortedList<ItemType, Allocator, IndexAllocator>::clear(void)
+{
+	for (int l = 0; l < levels; ++l)
+	{
+		SkipIndex<ItemType>* indexPtr = levelHead[l].right, *prevIndex;
+		while (indexPtr != nullptr)
+		{
+			prevIndex = indexPtr;
+			indexPtr = indexPtr->right;
+			IndexAllocator::deallocate(prevIndex);
+		}
+		levelHead[l].right = nullptr;
+	}
+	Node<ItemType>* curPtr = head.getNext(), *prevPtr;
+	while (curPtr != nullptr)
+	{
+		prevPtr = curPtr;
+		curPtr = curPtr->getNext();
+		freeListEl(prevPtr);
+	}
+	head.setNext(nullptr);
+	tailPtr = nullptr;
+	itemCount = 0;
+	levels = 0;
+}
+// Iterate down the Node chain printing items
+template<class ItemType, class Allocator, class IndexAllocator>
+void SortedList<ItemType, Allocator, IndexAllocator>::printList(void) const
+{
+	for (Node<ItemType>* curPtr = head.getNext(); curPtr != nullptr; curPtr = curPtr->getNext())
+		std::cout << curPtr->getItem();
+}
+// Points at the first Node (end if empty)
+template<class ItemType, class Allocator, class IndexAllocator>
+inline typename SortedList<ItemType, Allocator, IndexAllocator>::const_iterator
+	SortedList<ItemType, Allocator, IndexAllocator>::begin(void) const
+{
+	return const_iterator(head.getNext());
+}
+template<class ItemType, class Allocator, class IndexAllocator>
+inline typename SortedList<ItemType, Allocator, IndexAllocator>::const_iterator
+	SortedList<ItemType, Allocator, IndexAllocator>::cbegin(void) const
+{
+	return const_iterator(head.getNext());
+}
+// The last Node's next is nullptr, so end is nullptr
+template<class ItemType, class Allocator, class IndexAllocator>
+inline typename SortedList<ItemType, Allocator, IndexAllocator>::const_iterator
+	SortedList<ItemType, Allocator, IndexAllocator>::end(void) const
+{
+	return const_iterator(nullptr);
+}
+template<class ItemType, class Allocator, class IndexAllocator>
+inline typename SortedList<ItemType, Allocator, IndexAllocator>::const_iterator
+	SortedList<ItemType, Allocator, IndexAllocator>::cend(void) const
+{
+	return const_iterator(nullptr);
+}
+#endif
@@ -0,0 +1,802 @@
+/*
+* UnrolledList.h
+* Daniel Salazar
+* 10/18/2026
+* An unrolled linked list: each Node holds up to Capacity items
+* in a small array, so sequential scans touch one Node per
+* Capacity items instead of one per item
+* Nodes split when an insert overflows them and merge with
+* their neighbor when a remove leaves them less than half full
+* Searches and count, min, max and sum run SimdKernels over
+* each Node's array
+* UnrolledNode<ItemType, Capacity> is the List Element
+* UnrolledList<ItemType, Capacity, Allocator> is the collection
+*/
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+#include "LinkedList.h"
+#include "SimdKernels.h"
+#include <vector>		// vector
+// Default Capacity: about 128 bytes of items per Node
+template<class ItemType>
+struct UnrolledCapacity
+{
+	static const int value = (sizeof(ItemType) * 4 <= 128) ? int(128 / sizeof(ItemType)) : 4;
+};
+// A Node that holds an array of up to Capacity items
+// Items [0, count) are constructed, the rest is raw storage
+template<class ItemType, int Capacity>
+class UnrolledNode
+{
+private:
+	UnrolledNode<ItemType, Capacity>* next;
+	int count;
+	alignas(ItemType) unsigned char storage[Capacity * sizeof(ItemType)];
+public:
+	// Initializes an empty, unlinked Node
+	UnrolledNode();
+	// Destroys the Node's items
+	~UnrolledNode();
+	// Get Node's items as an array of getCount() items
+	ItemType* getItems();
+	const ItemType* getItems() const;
+	// Get number of items in Node
+	int getCount() const;
+	// Checks if count is Capacity
+	bool isFull() const;
+	// Sets Node's nextPtr
+	void setNext(UnrolledNode<ItemType, Capacity>* nextNodePtr);
+	// Get Node's nextPtr
+	UnrolledNode<ItemType, Capacity>* getNext() const;
+	// Builds an item from args at index, shifting later items up
+	template<class... Args>
+	void insertAt(int index, Args&&... args);
+	// Removes the item at index, shifting later items down
+	void eraseAt(int index);
+	// Moves items [from, count) to the end of aNode
+	void moveTo(int from, UnrolledNode<ItemType, Capacity>* aNode);
+};
+template<class ItemType, int Capacity>
+UnrolledNode<ItemType, Capacity>::UnrolledNode() : next(nullptr), count(0)
+{
+}
+template<class ItemType, int Capacity>
+UnrolledNode<ItemType, Capacity>::~UnrolledNode()
+{
+	ItemType* items = getItems();
+	for (int i = 0; i < count; ++i)
+		items[i].~ItemType();
+}
+template<class ItemType, int Capacity>
+inline ItemType* UnrolledNode<ItemType, Capacity>::getItems()
+{
+	return reinterpret_cast<ItemType*>(storage);
+}
+template<class ItemType, int Capacity>
+inline const ItemType* UnrolledNode<ItemType, Capacity>::getItems() const
+{
+	return reinterpret_cast<const ItemType*>(storage);
+}
+template<class ItemType, int Capacity>
+inline int UnrolledNode<ItemType, Capacity>::getCount() const
+{
+	return count;
+}
+template<class ItemType, int Capacity>
+inline bool UnrolledNode<ItemType, Capacity>::isFull() const
+{
+	return count == Capacity;
+}
+template<class ItemType, int Capacity>
+inline void UnrolledNode<ItemType, Capacity>::setNext(UnrolledNode<ItemType, Capacity>* nextNodePtr)
+{
+	next = nextNodePtr;
+}
+template<class ItemType, int Capacity>
+inline UnrolledNode<ItemType, Capacity>* UnrolledNode<ItemType, Capacity>::getNext() const
+{
+	return next;
+}
+// Up to the caller to check the Node isn't full
+// Appending constructs in place
+// Else build the new item first, since args may refer to an item
+// about to shift, then move the last item into new storage,
+// shift the rest up one, and move the new item into the hole
+template<class ItemType, int Capacity>
+template<class... Args>
+void UnrolledNode<ItemType, Capacity>::insertAt(int index, Args&&... args)
+{
+	assert((index >= 0) && (index <= count) && (count < Capacity));
+	ItemType* items = getItems();
+	if (index == count)
+		new (items + count) ItemType(std::forward<Args>(args)...);
+	else
+	{
+		ItemType newItem(std::forward<Args>(args)...);
+		new (items + count) ItemType(std::move(items[count - 1]));
+		for (int i = count - 1; i > index; --i)
+			items[i] = std::move(items[i - 1]);
+		items[index] = std::move(newItem);
+	}
+	++count;
+}
+// Shift later items down one and destroy the last
+template<class ItemType, int Capacity>
+void UnrolledNode<ItemType, Capacity>::eraseAt(int index)
+{
+	assert((index >= 0) && (index < count));
+	ItemType* items = getItems();
+	for (int i = index; i < count - 1; ++i)
+		items[i] = std::move(items[i + 1]);
+	items[--count].~ItemType();
+}
+// Up to the caller to make sure aNode has room
+template<class ItemType, int Capacity>
+void UnrolledNode<ItemType, Capacity>::moveTo(int from, UnrolledNode<ItemType, Capacity>* aNode)
+{
+	assert(aNode->count + (count - from) <= Capacity);
+	ItemType* items = getItems();
+	ItemType* dest = aNode->getItems();
+	for (int i = from; i < count; ++i)
+	{
+		new (dest + aNode->count++) ItemType(std::move(items[i]));
+		items[i].~ItemType();
+	}
+	count = from;
+}
+// Forward iterator over the items of an UnrolledList
+// ValueType is ItemType for iterator, const ItemType for const_iterator
+template<class ItemType, int Capacity, class ValueType>
+class UnrolledIterator
+{
+private:
+	// Current Node (nullptr is end) and index into its items
+	UnrolledNode<ItemType, Capacity>* curPtr;
+	int index;
+	template<class, int, class> friend class UnrolledIterator;
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef ItemType value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef ValueType* pointer;
+	typedef ValueType& reference;
+	// Singular iterator
+	UnrolledIterator();
+	// Points at item index of nodePtr
+	UnrolledIterator(UnrolledNode<ItemType, Capacity>* nodePtr, int anIndex);
+	// Copies an iterator, or converts iterator to const_iterator
+	UnrolledIterator(const UnrolledIterator<ItemType, Capacity, ItemType>& anIter);
+	UnrolledIterator<ItemType, Capacity, ValueType>& operator=(const UnrolledIterator<ItemType, Capacity, ValueType>& anIter) = default;
+	// Current item
+	reference operator*() const;
+	pointer operator->() const;
+	// Steps to the next item, moving to the next Node at the end of this one
+	UnrolledIterator<ItemType, Capacity, ValueType>& operator++();
+	UnrolledIterator<ItemType, Capacity, ValueType> operator++(int);
+	template<class OtherType>
+	bool operator==(const UnrolledIterator<ItemType, Capacity, OtherType>& rhs) const;
+	template<class OtherType>
+	bool operator!=(const UnrolledIterator<ItemType, Capacity, OtherType>& rhs) const;
+};
+template<class ItemType, int Capacity, class ValueType>
+inline UnrolledIterator<ItemType, Capacity, ValueType>::UnrolledIterator() : curPtr(nullptr), index(0)
+{
+}
+template<class ItemType, int Capacity, class ValueType>
+inline UnrolledIterator<ItemType, Capacity, ValueType>::UnrolledIterator(UnrolledNode<ItemType, Capacity>* nodePtr, int anIndex) :
+	curPtr(nodePtr), index(anIndex)
+{
+}
+template<class ItemType, int Capacity, class ValueType>
+inline UnrolledIterator<ItemType, Capacity, ValueType>::UnrolledIterator(const UnrolledIterator<ItemType, Capacity, ItemType>& anIter) :
+	curPtr(anIter.curPtr), index(anIter.index)
+{
+}
+template<class ItemType, int Capacity, class ValueType>
+inline typename UnrolledIterator<ItemType, Capacity, ValueType>::reference
+	UnrolledIterator<ItemType, Capacity, ValueType>::operator*() const
+{
+	return curPtr->getItems()[index];
+}
+template<class ItemType, int Capacity, class ValueType>
+inline typename UnrolledIterator<ItemType, Capacity, ValueType>::pointer
+	UnrolledIterator<ItemType, Capacity, ValueType>::operator->() const
+{
+	return curPtr->getItems() + index;
+}
+template<class ItemType, int Capacity, class ValueType>
+inline UnrolledIterator<ItemType, Capacity, ValueType>& UnrolledIterator<ItemType, Capacity, ValueType>::operator++()
+{
+	if (++index == curPtr->getCount())
+	{
+		curPtr = curPtr->getNext();
+		index = 0;
+	}
+	return *this;
+}
+template<class ItemType, int Capacity, class ValueType>
+inline UnrolledIterator<ItemType, Capacity, ValueType> UnrolledIterator<ItemType, Capacity, ValueType>::operator++(int)
+{
+	UnrolledIterator<ItemType, Capacity, ValueType> prev(*this);
+	++*this;
+	return prev;
+}
+template<class ItemType, int Capacity, class ValueType>
+template<class OtherType>
+inline bool UnrolledIterator<ItemType, Capacity, ValueType>::operator==(const UnrolledIterator<ItemType, Capacity, OtherType>& rhs) const
+{
+	return curPtr == rhs.curPtr && index == rhs.index;
+}
+template<class ItemType, int Capacity, class ValueType>
+template<class OtherType>
+inline bool UnrolledIterator<ItemType, Capacity, ValueType>::operator!=(const UnrolledIterator<ItemType, Capacity, OtherType>& rhs) const
+{
+	return !(*this == rhs);
+}
+// Unrolled Linked List of UnrolledNodes
+// Every Node but the last is kept at least half full
+template<class ItemType, int Capacity = UnrolledCapacity<ItemType>::value,
+	class Allocator = SlabAllocator<UnrolledNode<ItemType, Capacity> > >
+class UnrolledList : public ListInterface<ItemType>
+{
+private:
+	typedef UnrolledNode<ItemType, Capacity> NodeType;
+	// Points to nullptr/First Node
+	NodeType* headPtr;
+	// Points to nullptr/Last Node
+	NodeType* tailPtr;
+	// Count of items
+	int itemCount;
+	// Constructs an empty Node in storage from Allocator
+	NodeType* getListEl(void);
+	// Destroys a Node and returns it to Allocator
+	void freeListEl(NodeType* curPtr);
+	// Finds the Node holding position, sets index to its slot
+	NodeType* getNodeAt(int position, int& index) const;
+	// Splits a full Node in half, returns the new upper half
+	// Items in curPtr's upper half are moved, so references to them die
+	NodeType* split(NodeType* curPtr);
+	// Index of the first item in curPtr not less than anEntry
+	static int lowerIndex(const NodeType* curPtr, const ItemType& anEntry);
+	// Refills or merges a Node left less than half full
+	// prevPtr is the Node before curPtr (nullptr at head)
+	void rebalance(NodeType* prevPtr, NodeType* curPtr);
+public:
+	// Policy Nodes are allocated with
+	typedef Allocator allocator_type;
+	// What sum returns, see KernelSum
+	typedef typename SimdKernels<ItemType>::SumType sum_type;
+	// Forward iterators over the items
+	typedef UnrolledIterator<ItemType, Capacity, ItemType> iterator;
+	typedef UnrolledIterator<ItemType, Capacity, const ItemType> const_iterator;
+	// Default constructor
+	UnrolledList();
+	// List Copy Constructor
+	UnrolledList(const UnrolledList<ItemType, Capacity, Allocator>& aList);
+	// List Move Constructor, takes over aList's Nodes
+	UnrolledList(UnrolledList<ItemType, Capacity, Allocator>&& aList) noexcept;
+	// Assignment operator copies aList into thisList
+	UnrolledList<ItemType, Capacity, Allocator>& operator=(const UnrolledList<ItemType, Capacity, Allocator>& aList);
+	// Move assignment, takes over aList's Nodes
+	UnrolledList<ItemType, Capacity, Allocator>& operator=(UnrolledList<ItemType, Capacity, Allocator>&& aList) noexcept;
+	// Destructor
+	virtual ~UnrolledList();
+	// Modify a specified item
+	void setEntry(int position, const ItemType& newEntry);
+	// Get a specified item
+	const ItemType& getEntry(int position) const;
+	ItemType& getEntry(int position);
+	// Get number of items in List
+	int getLength() const;
+	// Sequential search for item in an ascending List
+	bool isInList(const ItemType& anEntry) const;
+	// Search for item in a List in any order
+	bool contains(const ItemType& anEntry) const;
+	// Number of items equal to anEntry
+	long long count(const ItemType& anEntry) const;
+	// Least and greatest items, the List must not be empty
+	ItemType minItem(void) const;
+	ItemType maxItem(void) const;
+	// Sum of the items
+	sum_type sum(void) const;
+	// Inserts an item into the specified position of thisList
+	void insert(int position, const ItemType& newEntry);
+	// Inserts an item in ascending order
+	void insertSorted(const ItemType& newEntry);
+	// Inserts an item at the beginning of List
+	void push(const ItemType& newEntry);
+	// Inserts an item at the end of List
+	void push_back(const ItemType& newEntry);
+	// Removes the first item equal to anEntry
+	bool remove(const ItemType& anEntry);
+	// Removes the first item
+	bool pop();
+	// Checks if itemCount is 0
+	bool isEmpty() const;
+	// Removes all Nodes in the List
+	void clear(void);
+	// Displays all items to stdout
+	void printList(int direction) const;
+	// printList's direction variables
+	static int Forward;
+	static int Reverse;
+	// Iterator to the first item
+	iterator begin(void);
+	const_iterator begin(void) const;
+	const_iterator cbegin(void) const;
+	// Iterator past the last item
+	iterator end(void);
+	const_iterator end(void) const;
+	const_iterator cend(void) const;
+};
+// Used with printList function
+template<class ItemType, int Capacity, class Allocator>
+int UnrolledList<ItemType, Capacity, Allocator>::Forward = 1;
+template<class ItemType, int Capacity, class Allocator>
+int UnrolledList<ItemType, Capacity, Allocator>::Reverse = -1;
+// Get storage from Allocator and construct an empty Node in it
+template<class ItemType, int Capacity, class Allocator>
+inline typename UnrolledList<ItemType, Capacity, Allocator>::NodeType*
+	UnrolledList<ItemType, Capacity, Allocator>::getListEl(void)
+{
+	return new (Allocator::allocate()) NodeType;
+}
+// Destroy the Node's items and hand its storage back to Allocator
+template<class ItemType, int Capacity, class Allocator>
+inline void UnrolledList<ItemType, Capacity, Allocator>::freeListEl(NodeType* curPtr)
+{
+	curPtr->~NodeType();
+	Allocator::deallocate(curPtr);
+}
+// Up to the user to enter a legal position
+// The last Node is checked first so back access is O(1)
+// Skip whole Nodes until position falls inside one
+template<class ItemType, int Capacity, class Allocator>
+typename UnrolledList<ItemType, Capacity, Allocator>::NodeType*
+	UnrolledList<ItemType, Capacity, Allocator>::getNodeAt(int position, int& index) const
+{
+	assert((position >= 1) && (position <= itemCount));
+	int skip = position - 1;
+	if (skip >= itemCount - tailPtr->getCount())
+	{
+		index = skip - (itemCount - tailPtr->getCount());
+		return tailPtr;
+	}
+	NodeType* curPtr = headPtr;
+	while (skip >= curPtr->getCount())
+	{
+		skip -= curPtr->getCount();
+		curPtr = curPtr->getNext();
+	}
+	index = skip;
+	return curPtr;
+}
+// Link a new Node after curPtr and move the upper half into it
+template<class ItemType, int Capacity, class Allocator>
+typename UnrolledList<ItemType, Capacity, Allocator>::NodeType*
+	UnrolledList<ItemType, Capacity, Allocator>::split(NodeType* curPtr)
+{
+	NodeType* newNode = getListEl();
+	curPtr->moveTo(curPtr->getCount() / 2, newNode);
+	newNode->setNext(curPtr->getNext());
+	curPtr->setNext(newNode);
+	if (tailPtr == curPtr)
+		tailPtr = newNode;
+	return newNode;
+}
+// Scan curPtr's items, the caller knows one is not less than anEntry
+template<class ItemType, int Capacity, class Allocator>
+int UnrolledList<ItemType, Capacity, Allocator>::lowerIndex(const NodeType* curPtr, const ItemType& anEntry)
+{
+	const ItemType* items = curPtr->getItems();
+	int index = 0;
+	while (items[index] < anEntry)
+		++index;
+	return index;
+}
+// An empty Node is unlinked and freed
+// Else if curPtr is less than half full and has a next Node:
+//  merge next into curPtr if both fit in one Node
+//  else borrow items from next until curPtr is half full
+template<class ItemType, int Capacity, class Allocator>
+void UnrolledList<ItemType, Capacity, Allocator>::rebalance(NodeType* prevPtr, NodeType* curPtr)
+{
+	NodeType* nextPtr = curPtr->getNext();
+	if (curPtr->getCount() == 0)
+	{
+		if (prevPtr == nullptr)
+			headPtr = nextPtr;
+		else
+			prevPtr->setNext(nextPtr);
+		if (tailPtr == curPtr)
+			tailPtr = prevPtr;
+		freeListEl(curPtr);
+	}
+	else if (curPtr->getCount() < Capacity / 2 && nextPtr != nullptr)
+	{
+		if (curPtr->getCount() + nextPtr->getCount() <= Capacity)
+		{
+			nextPtr->moveTo(0, curPtr);
+			curPtr->setNext(nextPtr->getNext());
+			if (tailPtr == nextPtr)
+				tailPtr = curPtr;
+			freeListEl(nextPtr);
+		}
+		else
+		{
+			while (curPtr->getCount() < Capacity / 2)
+			{
+				curPtr->insertAt(curPtr->getCount(), std::move(nextPtr->getItems()[0]));
+				nextPtr->eraseAt(0);
+			}
+		}
+	}
+}
+// Initiate the List's head, tail and itemCount
+template<class ItemType, int Capacity, class Allocator>
+UnrolledList<ItemType, Capacity, Allocator>::UnrolledList() :
+	headPtr(nullptr), tailPtr(nullptr), itemCount(0)
+{
+}
+// Start out empty
+// Append copies of aList's items, filling each Node
+template<class ItemType, int Capacity, class Allocator>
+UnrolledList<ItemType, Capacity, Allocator>::UnrolledList(const UnrolledList<ItemType, Capacity, Allocator>& aList) :
+	headPtr(nullptr), tailPtr(nullptr), itemCount(0)
+{
+	for (const_iterator it = aList.cbegin(); it != aList.cend(); ++it)
+		push_back(*it);
+}
+// Takes aList's head, tail and count
+// Leaves aList empty
+template<class ItemType, int Capacity, class Allocator>
+UnrolledList<ItemType, Capacity, Allocator>::UnrolledList(UnrolledList<ItemType, Capacity, Allocator>&& aList) noexcept :
+	headPtr(aList.headPtr), tailPtr(aList.tailPtr), itemCount(aList.itemCount)
+{
+	aList.headPtr = aList.tailPtr = nullptr;
+	aList.itemCount = 0;
+}
+// Prevent from self assignment
+// Clears thisList
+// Copies all aList items into thisList
+template<class ItemType, int Capacity, class Allocator>
+UnrolledList<ItemType, Capacity, Allocator>& UnrolledList<ItemType, Capacity, Allocator>::operator=(const UnrolledList<ItemType, Capacity, Allocator>& aList)
+{
+	assert(this != &aList);
+	clear();
+	for (const_iterator it = aList.cbegin(); it != aList.cend(); ++it)
+		push_back(*it);
+	return *this;
+}
+// Clears thisList
+// Takes aList's head, tail and count
+template<class ItemType, int Capacity, class Allocator>
+UnrolledList<ItemType, Capacity, Allocator>& UnrolledList<ItemType, Capacity, Allocator>::operator=(UnrolledList<ItemType, Capacity, Allocator>&& aList) noexcept
+{
+	if (this == &aList) return *this;
+	clear();
+	headPtr = aList.headPtr;
+	tailPtr = aList.tailPtr;
+	itemCount = aList.itemCount;
+	aList.headPtr = aList.tailPtr = nullptr;
+	aList.itemCount = 0;
+	return *this;
+}
+// Destructor just uses clear
+template<class ItemType, int Capacity, class Allocator>
+UnrolledList<ItemType, Capacity, Allocator>::~UnrolledList()
+{
+	clear();
+}
+// Up to the user to enter a legal position
+// Modifies specified item
+template<class ItemType, int Capacity, class Allocator>
+void UnrolledList<ItemType, Capacity, Allocator>::setEntry(int position, const ItemType& newEntry)
+{
+	int index;
+	NodeType* curPtr = getNodeAt(position, index);
+	curPtr->getItems()[index] = newEntry;
+}
+// Up to the user to enter a legal position
+// Returns the specified item by reference
+template<class ItemType, int Capacity, class Allocator>
+const ItemType& UnrolledList<ItemType, Capacity, Allocator>::getEntry(int position) const
+{
+	int index;
+	NodeType* curPtr = getNodeAt(position, index);
+	return curPtr->getItems()[index];
+}
+template<class ItemType, int Capacity, class Allocator>
+ItemType& UnrolledList<ItemType, Capacity, Allocator>::getEntry(int position)
+{
+	int index;
+	NodeType* curPtr = getNodeAt(position, index);
+	return curPtr->getItems()[index];
+}
+// Returns count of items
+template<class ItemType, int Capacity, class Allocator>
+int UnrolledList<ItemType, Capacity, Allocator>::getLength() const
+{
+	return itemCount;
+}
+// Skip every Node whose last item is less than anEntry
+// Then scan that Node's array for anEntry
+template<class ItemType, int Capacity, class Allocator>
+bool UnrolledList<ItemType, Capacity, Allocator>::isInList(const ItemType& anEntry) const
+{
+	NodeType* curPtr = headPtr;
+	while (curPtr != nullptr && curPtr->getItems()[curPtr->getCount() - 1] < anEntry)
+		curPtr = curPtr->getNext();
+	if (curPtr == nullptr) return false;
+	const ItemType* items = curPtr->getItems();
+	int i = 0;
+	while (items[i] < anEntry)
+		++i;
+	return items[i] == anEntry;
+}
+// Search each Node's array in turn, stop at the first match
+template<class ItemType, int Capacity, class Allocator>
+bool UnrolledList<ItemType, Capacity, Allocator>::contains(const ItemType& anEntry) const
+{
+	for (NodeType* curPtr = headPtr; curPtr != nullptr; curPtr = curPtr->getNext())
+	{
+		const ItemType* items = curPtr->getItems();
+		if (SimdKernels<ItemType>::find(items, items + curPtr->getCount(), anEntry) != items + curPtr->getCount())
+			return true;
+	}
+	return false;
+}
+// Add up the matches in each Node's array
+template<class ItemType, int Capacity, class Allocator>
+long long UnrolledList<ItemType, Capacity, Allocator>::count(const ItemType& anEntry) const
+{
+	long long total = 0;
+	for (NodeType* curPtr = headPtr; curPtr != nullptr; curPtr = curPtr->getNext())
+		total += SimdKernels<ItemType>::count(curPtr->getItems(), curPtr->getItems() + curPtr->getCount(), anEntry);
+	return total;
+}
+// Up to the user to check the List isn't empty
+// Every Node holds at least one item, so each has a least item
+// Keep the least of those
+template<class ItemType, int Capacity, class Allocator>
+ItemType UnrolledList<ItemType, Capacity, Allocator>::minItem(void) const
+{
+	assert(headPtr != nullptr);
+	ItemType least = SimdKernels<ItemType>::minItem(headPtr->getItems(), headPtr->getItems() + headPtr->getCount());
+	for (NodeType* curPtr = headPtr->getNext(); curPtr != nullptr; curPtr = curPtr->getNext())
+	{
+		ItemType nodeLeast = SimdKernels<ItemType>::minItem(curPtr->getItems(), curPtr->getItems() + curPtr->getCount());
+		if (nodeLeast < least) least = nodeLeast;
+	}
+	return least;
+}
+template<class ItemType, int Capacity, class Allocator>
+ItemType UnrolledList<ItemType, Capacity, Allocator>::maxItem(void) const
+{
+	assert(headPtr != nullptr);
+	ItemType greatest = SimdKernels<ItemType>::maxItem(headPtr->getItems(), headPtr->getItems() + headPtr->getCount());
+	for (NodeType* curPtr = headPtr->getNext(); curPtr != nullptr; curPtr = curPtr->getNext())
+	{
+		ItemType nodeGreatest = SimdKernels<ItemType>::maxItem(curPtr->getItems(), curPtr->getItems() + curPtr->getCount());
+		if (greatest < nodeGreatest) greatest = nodeGreatest;
+	}
+	return greatest;
+}
+// Add up each Node's sum
+template<class ItemType, int Capacity, class Allocator>
+typename UnrolledList<ItemType, Capacity, Allocator>::sum_type UnrolledList<ItemType, Capacity, Allocator>::sum(void) const
+{
+	sum_type total = sum_type();
+	for (NodeType* curPtr = headPtr; curPtr != nullptr; curPtr = curPtr->getNext())
+		total = total + SimdKernels<ItemType>::sum(curPtr->getItems(), curPtr->getItems() + curPtr->getCount());
+	return total;
+}
+// Front and back go through push and push_back
+// Else find the Node holding position
+// If it is full, copy newEntry first (it may be one of the items
+// split moves), split it and pick the half position falls in
+// Shift the new item into that Node's array
+template<class ItemType, int Capacity, class Allocator>
+void UnrolledList<ItemType, Capacity, Allocator>::insert(int position, const ItemType& newEntry)
+{
+	assert((position >= 1) && (position <= itemCount + 1));
+	if (position == 1) push(newEntry);
+	else if (position == itemCount + 1) push_back(newEntry);
+	else
+	{
+		int index;
+		NodeType* curPtr = getNodeAt(position, index);
+		if (curPtr->isFull())
+		{
+			ItemType entry(newEntry);
+			NodeType* newNode = split(curPtr);
+			if (index > curPtr->getCount())
+			{
+				index -= curPtr->getCount();
+				curPtr = newNode;
+			}
+			curPtr->insertAt(index, std::move(entry));
+		}
+		else
+			curPtr->insertAt(index, newEntry);
+		++itemCount;
+	}
+}
+// Entries arriving in order go straight to the tail
+// Else skip every Node whose last item is less than newEntry
+// If that Node is full, split it and insert a copy of newEntry,
+// which may be one of the items split moves
+// Shift newEntry in before the first item not less than it
+template<class ItemType, int Capacity, class Allocator>
+void UnrolledList<ItemType, Capacity, Allocator>::insertSorted(const ItemType& newEntry)
+{
+	if (headPtr == nullptr || tailPtr->getItems()[tailPtr->getCount() - 1] < newEntry)
+	{
+		push_back(newEntry);
+		return;
+	}
+	NodeType* curPtr = headPtr;
+	while (curPtr->getItems()[curPtr->getCount() - 1] < newEntry)
+		curPtr = curPtr->getNext();
+	if (curPtr->isFull())
+	{
+		ItemType entry(newEntry);
+		NodeType* newNode = split(curPtr);
+		if (curPtr->getItems()[curPtr->getCount() - 1] < entry)
+			curPtr = newNode;
+		curPtr->insertAt(lowerIndex(curPtr, entry), std::move(entry));
+	}
+	else
+		curPtr->insertAt(lowerIndex(curPtr, newEntry), newEntry);
+	++itemCount;
+}
+// If there is no Node, link a new one
+// Else if the first Node is full, copy newEntry (it may be one of
+// the items split moves) and split it
+// Shift newEntry into the front of the first Node
+template<class ItemType, int Capacity, class Allocator>
+void UnrolledList<ItemType, Capacity, Allocator>::push(const ItemType& newEntry)
+{
+	if (headPtr == nullptr)
+		headPtr = tailPtr = getListEl();
+	else if (headPtr->isFull())
+	{
+		ItemType entry(newEntry);
+		split(headPtr);
+		headPtr->insertAt(0, std::move(entry));
+		++itemCount;
+		return;
+	}
+	headPtr->insertAt(0, newEntry);
+	++itemCount;
+}
+// If the last Node is full (or there is none), link a new Node
+// after it, then append newEntry to the last Node
+template<class ItemType, int Capacity, class Allocator>
+void UnrolledList<ItemType, Capacity, Allocator>::push_back(const ItemType& newEntry)
+{
+	if (tailPtr == nullptr || tailPtr->isFull())
+	{
+		NodeType* newNode = getListEl();
+		if (tailPtr == nullptr)
+			headPtr = newNode;
+		else
+			tailPtr->setNext(newNode);
+		tailPtr = newNode;
+	}
+	tailPtr->insertAt(tailPtr->getCount(), newEntry);
+	++itemCount;
+}
+// Inchworm down the List one Node at a time
+// Scan each Node's array for anEntry
+// If found, erase it and rebalance that Node
+template<class ItemType, int Capacity, class Allocator>
+bool UnrolledList<ItemType, Capacity, Allocator>::remove(const ItemType& anEntry)
+{
+	NodeType* curPtr = headPtr, *prevPtr = nullptr;
+	while (curPtr != nullptr)
+	{
+		const ItemType* items = curPtr->getItems();
+		const ItemType* found = SimdKernels<ItemType>::find(items, items + curPtr->getCount(), anEntry);
+		if (found != items + curPtr->getCount())
+		{
+			curPtr->eraseAt(int(found - items));
+			--itemCount;
+			rebalance(prevPtr, curPtr);
+			return true;
+		}
+		prevPtr = curPtr;
+		curPtr = curPtr->getNext();
+	}
+	return false;
+}
+// Removes the first item in thisList
+template<class ItemType, int Capacity, class Allocator>
+bool UnrolledList<ItemType, Capacity, Allocator>::pop()
+{
+	if (headPtr == nullptr) return false;
+	headPtr->eraseAt(0);
+	--itemCount;
+	rebalance(nullptr, headPtr);
+	return true;
+}
+// Check if List has zero items
+template<class ItemType, int Capacity, class Allocator>
+bool UnrolledList<ItemType, Capacity, Allocator>::isEmpty() const
+{
+	return itemCount == 0;
+}
+// Iterate down List returning Nodes to Allocator
+// Zero out thisList
+template<class ItemType, int Capacity, class Allocator>
+void UnrolledList<ItemType, Capacity, Allocator>::clear(void)
+{
+	NodeType* curPtr = headPtr, *prevPtr;
+	while (curPtr != nullptr)
+	{
+		prevPtr = curPtr;
+		curPtr = curPtr->getNext();
+		freeListEl(prevPtr);
+	}
+	headPtr = tailPtr = nullptr;
+	itemCount = 0;
+}
+// If direction == 1, print each Node's array in order
+// Else collect the Nodes, then print them and their
+// arrays back to front
+template<class ItemType, int Capacity, class Allocator>
+void UnrolledList<ItemType, Capacity, Allocator>::printList(int direction) const
+{
+	if (direction == Forward)
+	{
+		for (NodeType* curPtr = headPtr; curPtr != nullptr; curPtr = curPtr->getNext())
+		{
+			const ItemType* items = curPtr->getItems();
+			for (int i = 0; i < curPtr->getCount(); ++i)
+				std::cout << items[i];
+		}
+	}
+	else
+	{
+		std::vector<const NodeType*> nodes;
+		for (NodeType* curPtr = headPtr; curPtr != nullptr; curPtr = curPtr->getNext())
+			nodes.push_back(curPtr);
+		for (int n = int(nodes.size()) - 1; n >= 0; --n)
+		{
+			const ItemType* items = nodes[n]->getItems();
+			for (int i = nodes[n]->getCount() - 1; i >= 0; --i)
+				std::cout << items[i] << " ";
+		}
+	}
+}
+template<class ItemType, int Capacity, class Allocator>
+inline typename UnrolledList<ItemType, Capacity, Allocator>::iterator UnrolledList<ItemType, Capacity, Allocator>::begin(void)
+{
+	return iterator(headPtr, 0);
+}
+template<class ItemType, int Capacity, class Allocator>
+inline typename UnrolledList<ItemType, Capacity, Allocator>::const_iterator UnrolledList<ItemType, Capacity, Allocator>::begin(void) const
+{
+	return const_iterator(headPtr, 0);
+}
+template<class ItemType, int Capacity, class Allocator>
+inline typename UnrolledList<ItemType, Capacity, Allocator>::const_iterator UnrolledList<ItemType, Capacity, Allocator>::cbegin(void) const
+{
+	return const_iterator(headPtr, 0);
+}
+template<class ItemType, int Capacity, class Allocator>
+inline typename UnrolledList<ItemType, Capacity, Allocator>::iterator UnrolledList<ItemType, Capacity, Allocator>::end(void)
+{
+	return iterator(nullptr, 0);
+}
+template<class ItemType, int Capacity, class Allocator>
+inline typename UnrolledList<ItemType, Capacity, Allocator>::const_iterator UnrolledList<ItemType, Capacity, Allocator>::end(void) const
+{
+	return const_iterator(nullptr, 0);
+}
+template<class ItemType, int Capacity, class Allocator>
+inline typename UnrolledList<ItemType, Capacity, Allocator>::const_iterator UnrolledList<ItemType, Capacity, Allocator>::cend(void) const
+{
+	return const_iterator(nullptr, 0);
+}
+#endif
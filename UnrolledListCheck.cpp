@@ -0,0 +1,110 @@
+/*
+* UnrolledListCheck.cpp
+* Daniel Salazar
+* 10/18/2026
+* Checks UnrolledList inserts whose entry is an item of the same
+* list, into full Nodes (which split) and non-full ones (which
+* shift), against a std::vector doing the same thing
+* Usage: UnrolledListCheck [ops]
+* Returns the number of mismatches
+*/
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "UnrolledList.h"
+// Four items per Node, so inserts split often
+typedef UnrolledList<std::string, 4> List;
+// Long enough to live on the heap, so a moved-from item is empty
+std::string makeItem(int key)
+{
+	return "item number " + std::to_string(key) + " of the check";
+}
+// Compare every position of aList with expected
+int compare(const char* what, const List& aList, const std::vector<std::string>& expected)
+{
+	int errors = 0;
+	if (aList.getLength() != int(expected.size())) ++errors;
+	else
+		for (int i = 0; i < aList.getLength(); ++i)
+			if (aList.getEntry(i + 1) != expected[i]) ++errors;
+	if (errors != 0)
+		std::cout << what << ": " << errors << " mismatches" << std::endl;
+	return errors;
+}
+// Fill a List of count items, every Node full but the last
+List fill(int count, std::vector<std::string>& expected)
+{
+	List aList;
+	expected.clear();
+	for (int i = 0; i < count; ++i)
+	{
+		aList.push_back(makeItem(i));
+		expected.push_back(makeItem(i));
+	}
+	return aList;
+}
+// One case per insert and Node state, then a random mix
+int main(int argc, char* argv[])
+{
+	int ops = (argc > 1) ? std::atoi(argv[1]) : 20000;
+	int errors = 0;
+	std::vector<std::string> expected;
+	// Full head Node: push splits it
+	List aList = fill(8, expected);
+	aList.push(aList.getEntry(3));
+	expected.insert(expected.begin(), expected[2]);
+	errors += compare("push into a full Node", aList, expected);
+	// Non-full head Node: push shifts it
+	aList = fill(3, expected);
+	aList.push(aList.getEntry(2));
+	expected.insert(expected.begin(), expected[1]);
+	errors += compare("push into a non-full Node", aList, expected);
+	// Full middle Node: insert splits it
+	aList = fill(12, expected);
+	aList.insert(6, aList.getEntry(8));
+	expected.insert(expected.begin() + 5, std::string(expected[7]));
+	errors += compare("insert into a full Node", aList, expected);
+	// Non-full Node: insert shifts it
+	aList = fill(3, expected);
+	aList.insert(2, aList.getEntry(3));
+	expected.insert(expected.begin() + 1, std::string(expected[2]));
+	errors += compare("insert into a non-full Node", aList, expected);
+	// Full Node: insertSorted splits it (keys 0-7 fill in order)
+	aList = fill(8, expected);
+	aList.insertSorted(aList.getEntry(4));
+	expected.insert(expected.begin() + 3, std::string(expected[3]));
+	errors += compare("insertSorted into a full Node", aList, expected);
+	// Non-full Node: insertSorted shifts it
+	aList = fill(3, expected);
+	aList.insertSorted(aList.getEntry(2));
+	expected.insert(expected.begin() + 1, std::string(expected[1]));
+	errors += compare("insertSorted into a non-full Node", aList, expected);
+	// Random positions and entries, Nodes both full and not
+	aList = fill(1, expected);
+	srand(1);
+	for (int i = 0; i < ops; ++i)
+	{
+		int from = rand() % aList.getLength();
+		std::string entry = expected[from];
+		if (rand() % 2 == 0)
+		{
+			aList.push(aList.getEntry(from + 1));
+			expected.insert(expected.begin(), entry);
+		}
+		else
+		{
+			int position = rand() % (aList.getLength() + 1) + 1;
+			aList.insert(position, aList.getEntry(from + 1));
+			expected.insert(expected.begin() + (position - 1), entry);
+		}
+		if (aList.getLength() > 200)
+		{
+			aList.pop();
+			expected.erase(expected.begin());
+		}
+	}
+	errors += compare("random inserts", aList, expected);
+	std::cout << "UnrolledListCheck: " << errors << " mismatches" << std::endl;
+	return errors == 0 ? 0 : 1;
+}
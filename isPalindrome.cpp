@@ -1,22 +1,23 @@
 #include<iostream>
+#include<cstring>
 #include "LinkedList.h"
-bool isPalindrome(LinkedList<char> &s)
+#include "ListView.h"
+bool isPalindrome(const ListView<char> &s)
 {
 	if (s.isEmpty() || s.getLength() == 1)
 		return true;
 	else if (s.getEntry(1) == s.getEntry(s.getLength()))
-		return isPalindrome(s.subStr(2, s.getLength() - 2));
+		return isPalindrome(s.subView(2, s.getLength() - 2));
 	else
 		return false;
 }
 int main()
 {
-	LinkedList<char> word1, word2;
 	char s1[] = { "tattattat" };
-	for (unsigned int i = 0; i < strlen(s1); ++i) word1.push(s1[i]);
+	LinkedList<char> word1(s1, s1 + strlen(s1));
 	std::cout << isPalindrome(word1) << std::endl;
 	char s2[] = { "ermehgerd" };
-	for (unsigned int i = 0; i < strlen(s2); ++i) word2.push(s2[i]);
+	LinkedList<char> word2(s2, s2 + strlen(s2));
 	std::cout << isPalindrome(word2) << std::endl;
 	int stop;
 	std::cin >> stop;